@@ -0,0 +1,208 @@
+#include "APSPAlgorithm.hpp"
+#include "SSSPAlgorithm.hpp"
+#include "ThreadPool.hpp"
+#include <algorithm>
+#include <string>
+#include <vector>
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#endif
+
+namespace {
+
+const int TILE = 64;
+const long long INF = (long long)(~0ULL >> 3);  // INF + INF still fits in a long long
+
+// c[i][j] = min(c[i][j], a[i][k] + b[k][j]) over one tile, k outermost. c may be a or b:
+// with k outermost this is exactly the Floyd-Warshall order inside the tile.
+void minPlusScalar(long long* c, const long long* a, const long long* b, int stride) {
+    for (int k = 0; k < TILE; ++k) {
+        const long long* bk = b + (size_t)k * stride;
+        for (int i = 0; i < TILE; ++i) {
+            long long aik = a[(size_t)i * stride + k];
+            if (aik >= INF) continue;
+            long long* ci = c + (size_t)i * stride;
+            for (int j = 0; j < TILE; ++j) {
+                long long v = aik + bk[j];
+                if (v < ci[j]) ci[j] = v;
+            }
+        }
+    }
+}
+
+#if defined(__x86_64__) || defined(__i386__)
+__attribute__((target("avx2")))
+void minPlusAvx2(long long* c, const long long* a, const long long* b, int stride) {
+    for (int k = 0; k < TILE; ++k) {
+        const long long* bk = b + (size_t)k * stride;
+        for (int i = 0; i < TILE; ++i) {
+            long long aik = a[(size_t)i * stride + k];
+            if (aik >= INF) continue;
+            long long* ci = c + (size_t)i * stride;
+            __m256i va = _mm256_set1_epi64x(aik);
+            for (int j = 0; j < TILE; j += 4) {
+                __m256i sum = _mm256_add_epi64(va, _mm256_loadu_si256((const __m256i*)(bk + j)));
+                __m256i cur = _mm256_loadu_si256((const __m256i*)(ci + j));
+                __m256i better = _mm256_cmpgt_epi64(cur, sum);
+                _mm256_storeu_si256((__m256i*)(ci + j), _mm256_blendv_epi8(cur, sum, better));
+            }
+        }
+    }
+}
+#endif
+
+typedef void (*MinPlusKernel)(long long*, const long long*, const long long*, int);
+
+MinPlusKernel pickKernel() {
+#if defined(__x86_64__) || defined(__i386__)
+    if (__builtin_cpu_supports("avx2")) return minPlusAvx2;
+#endif
+    return minPlusScalar;
+}
+
+}
+
+bool APSPAlgorithm::floydWarshall(const Graph::Graph& graph, std::vector<long long>& dist) {
+    int n = graph.numOfVertices();
+    int tiles = (n + TILE - 1) / TILE;
+    int N = tiles * TILE; // padding vertices have no edges and never shorten a path
+
+    std::vector<long long> d((size_t)N * N, INF);
+    for (int u = 0; u < N; ++u) d[(size_t)u * N + u] = 0;
+    for (int u = 0; u < n; ++u) {
+        const std::vector<int>& adj = graph.neighbors(u);
+        for (size_t i = 0; i < adj.size(); ++i) d[(size_t)u * N + adj[i]] = graph.getEdgeWeight(u, adj[i]);
+    }
+
+    MinPlusKernel kernel = pickKernel();
+    ThreadPool& pool = ThreadPool::shared();
+    auto tile = [&](int ti, int tj) { return &d[(size_t)ti * TILE * N + (size_t)tj * TILE]; };
+
+    for (int k = 0; k < tiles; ++k) {
+        // 1. The diagonal tile depends only on itself.
+        kernel(tile(k, k), tile(k, k), tile(k, k), N);
+
+        // 2. Tiles in row k and column k need only themselves and the diagonal tile.
+        pool.parallelFor(0, 2 * tiles, [&](int lo, int hi) {
+            for (int t = lo; t < hi; ++t) {
+                int other = t % tiles;
+                if (other == k) continue;
+                if (t < tiles) kernel(tile(k, other), tile(k, k), tile(k, other), N);
+                else kernel(tile(other, k), tile(other, k), tile(k, k), N);
+            }
+        }, 1);
+
+        // 3. Every remaining tile combines its row-k and column-k tiles; all independent.
+        pool.parallelFor(0, tiles * tiles, [&](int lo, int hi) {
+            for (int t = lo; t < hi; ++t) {
+                int i = t / tiles, j = t % tiles;
+                if (i == k || j == k) continue;
+                kernel(tile(i, j), tile(i, k), tile(k, j), N);
+            }
+        }, 1);
+    }
+
+    dist.assign((size_t)n * n, SSSPAlgorithm::UNREACHABLE);
+    for (int u = 0; u < n; ++u) {
+        if (d[(size_t)u * N + u] < 0) return false;
+        for (int v = 0; v < n; ++v) {
+            // Sums through unreachable entries can dip below INF with negative weights,
+            // but never below INF / 2.
+            long long x = d[(size_t)u * N + v];
+            if (x < INF / 2) dist[(size_t)u * n + v] = x;
+        }
+    }
+    return true;
+}
+
+bool APSPAlgorithm::johnson(const Graph::Graph& graph, std::vector<long long>& dist) {
+    int n = graph.numOfVertices();
+    bool negative = false;
+    for (int u = 0; u < n && !negative; ++u) {
+        const std::vector<int>& adj = graph.neighbors(u);
+        for (size_t i = 0; i < adj.size() && !negative; ++i) negative = graph.getEdgeWeight(u, adj[i]) < 0;
+    }
+
+    // Potentials: distances from a virtual source with a 0-weight edge to every vertex,
+    // by Bellman-Ford with a work queue. A vertex relaxed more than n times means a negative cycle.
+    std::vector<long long> potential(n, 0);
+    if (negative) {
+        std::vector<int> queue, relaxed(n, 0);
+        std::vector<bool> queued(n, true);
+        for (int v = 0; v < n; ++v) queue.push_back(v);
+        for (size_t head = 0; head < queue.size(); ++head) {
+            int u = queue[head];
+            queued[u] = false;
+            const std::vector<int>& adj = graph.neighbors(u);
+            for (size_t i = 0; i < adj.size(); ++i) {
+                int v = adj[i];
+                long long nd = potential[u] + graph.getEdgeWeight(u, v);
+                if (nd >= potential[v]) continue;
+                potential[v] = nd;
+                if (++relaxed[v] > n) return false;
+                if (!queued[v]) { queued[v] = true; queue.push_back(v); }
+            }
+        }
+    }
+
+    dist.assign((size_t)n * n, SSSPAlgorithm::UNREACHABLE);
+    const std::vector<long long>* reweight = negative ? &potential : nullptr;
+    ThreadPool::shared().parallelFor(0, n, [&](int lo, int hi) {
+        std::vector<long long> row;
+        for (int s = lo; s < hi; ++s) {
+            SSSPAlgorithm::dijkstra(graph, s, row, nullptr, reweight);
+            std::copy(row.begin(), row.end(), dist.begin() + (size_t)s * n);
+        }
+    });
+    return true;
+}
+
+std::string APSPAlgorithm::run(const Graph::Graph& graph) {
+    return run(graph, AlgorithmParams());
+}
+
+std::string APSPAlgorithm::run(const Graph::Graph& graph, const AlgorithmParams& params) {
+    int n = graph.numOfVertices();
+    std::vector<int> pairs = params.getIntList("pairs");
+    if (pairs.size() % 2 != 0) return "Invalid pairs: expected u1,v1,u2,v2,...";
+    for (size_t i = 0; i < pairs.size(); ++i)
+        if (pairs[i] < 0 || pairs[i] >= n)
+            return "Invalid pairs: vertices must be between 0 and " + std::to_string(n - 1);
+
+    // Floyd-Warshall is Theta(n^3) whatever the edge count; below average degree n/16
+    // n Dijkstra runs are cheaper.
+    long long edges = 0;
+    for (int u = 0; u < n; ++u) edges += graph.neighbors(u).size();
+    std::string mode = params.getString("mode", "auto");
+    if (mode == "auto") mode = edges * 16 < (long long)n * n ? "johnson" : "floyd";
+
+    std::vector<long long> dist;
+    bool ok;
+    if (mode == "floyd") ok = floydWarshall(graph, dist);
+    else if (mode == "johnson") ok = johnson(graph, dist);
+    else return "Unknown mode: " + mode + " (use auto, floyd or johnson)";
+    if (!ok) return "Negative cycle: shortest paths are undefined";
+
+    long long reachable = 0;
+    for (size_t i = 0; i < dist.size(); ++i)
+        if (dist[i] != SSSPAlgorithm::UNREACHABLE) ++reachable;
+    std::string result = "All-pairs shortest paths (" + mode + "): " + std::to_string(reachable) + " of " +
+                         std::to_string((long long)n * n) + " pairs reachable";
+
+    auto text = [&](int u, int v) {
+        long long x = dist[(size_t)u * n + v];
+        return x == SSSPAlgorithm::UNREACHABLE ? std::string("-") : std::to_string(x);
+    };
+    if (!pairs.empty()) {
+        for (size_t i = 0; i < pairs.size(); i += 2)
+            result += "\n       " + std::to_string(pairs[i]) + "->" + std::to_string(pairs[i + 1]) + ": " +
+                      text(pairs[i], pairs[i + 1]);
+        return result;
+    }
+    result.reserve(result.size() + (size_t)n * n * 4);
+    for (int u = 0; u < n; ++u) {
+        result += "\n       " + std::to_string(u) + ":";
+        for (int v = 0; v < n; ++v) result += " " + text(u, v);
+    }
+    return result;
+}
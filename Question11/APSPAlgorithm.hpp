@@ -0,0 +1,28 @@
+#ifndef APSP_ALGORITHM_HPP
+#define APSP_ALGORITHM_HPP
+
+#include "GraphAlgorithm.hpp"
+#include <vector>
+
+/**
+ * @brief All-pairs shortest paths: blocked Floyd-Warshall for dense graphs, Johnson for sparse
+ * @details Floyd-Warshall works on a padded copy of the matrix cut into 64x64 tiles. For every
+ *          diagonal tile k it updates that tile, then the tiles sharing its row or column, then
+ *          all the rest; tiles within the last two steps are independent and run in parallel
+ *          on the shared ThreadPool. The min-plus tile kernel uses AVX2 when the CPU has it.
+ *          Johnson runs one Dijkstra per source (in parallel), after Bellman-Ford potentials
+ *          when the graph has negative weights.
+ */
+class APSPAlgorithm : public GraphAlgorithm {
+public:
+    std::string run(const Graph::Graph& graph) override;
+    // Options: mode=auto|floyd|johnson, pairs=u1,v1,u2,v2,... report only these distances
+    std::string run(const Graph::Graph& graph, const AlgorithmParams& params) override;
+
+    // dist[u*n + v] = length of a shortest u->v path, SSSPAlgorithm::UNREACHABLE if none.
+    // Both return false (leaving dist unspecified) if the graph has a negative cycle.
+    static bool floydWarshall(const Graph::Graph& graph, std::vector<long long>& dist);
+    static bool johnson(const Graph::Graph& graph, std::vector<long long>& dist);
+};
+
+#endif // APSP_ALGORITHM_HPP
@@ -0,0 +1,65 @@
+#include "AlgorithmParams.hpp"
+#include <sstream>
+#include <stdlib.h>
+
+AlgorithmParams AlgorithmParams::parse(const std::string& text) {
+    AlgorithmParams params;
+    std::istringstream iss(text);
+    std::string token;
+    while (iss >> token) {
+        size_t eq = token.find('=');
+        if (eq == std::string::npos || eq == 0) continue;
+        params.set(token.substr(0, eq), token.substr(eq + 1));
+    }
+    return params;
+}
+
+void AlgorithmParams::set(const std::string& key, const std::string& value) {
+    values[key] = value;
+}
+
+bool AlgorithmParams::has(const std::string& key) const {
+    return values.count(key) != 0;
+}
+
+std::string AlgorithmParams::getString(const std::string& key, const std::string& def) const {
+    std::map<std::string, std::string>::const_iterator it = values.find(key);
+    return it == values.end() ? def : it->second;
+}
+
+int AlgorithmParams::getInt(const std::string& key, int def) const {
+    std::map<std::string, std::string>::const_iterator it = values.find(key);
+    if (it == values.end()) return def;
+    char* end = nullptr;
+    long v = strtol(it->second.c_str(), &end, 10);
+    return (end == it->second.c_str() || *end != '\0') ? def : (int)v;
+}
+
+double AlgorithmParams::getDouble(const std::string& key, double def) const {
+    std::map<std::string, std::string>::const_iterator it = values.find(key);
+    if (it == values.end()) return def;
+    char* end = nullptr;
+    double v = strtod(it->second.c_str(), &end);
+    return (end == it->second.c_str() || *end != '\0') ? def : v;
+}
+
+bool AlgorithmParams::getBool(const std::string& key, bool def) const {
+    std::map<std::string, std::string>::const_iterator it = values.find(key);
+    if (it == values.end()) return def;
+    const std::string& v = it->second;
+    if (v == "1" || v == "true" || v == "yes" || v == "on") return true;
+    if (v == "0" || v == "false" || v == "no" || v == "off") return false;
+    return def;
+}
+
+std::vector<int> AlgorithmParams::getIntList(const std::string& key) const {
+    std::vector<int> list;
+    std::map<std::string, std::string>::const_iterator it = values.find(key);
+    if (it == values.end()) return list;
+    std::istringstream iss(it->second);
+    std::string item;
+    while (std::getline(iss, item, ',')) {
+        if (!item.empty()) list.push_back(atoi(item.c_str()));
+    }
+    return list;
+}
@@ -0,0 +1,43 @@
+#ifndef ALGORITHM_PARAMS_HPP
+#define ALGORITHM_PARAMS_HPP
+
+#include <map>
+#include <string>
+#include <vector>
+
+/**
+ * @brief Options of one algorithm request, e.g. "s=2 t=7" for maxflow
+ * @details Parsed from whitespace separated key=value tokens. Getters fall back to the
+ *          given default when a key is missing or its value does not parse.
+ */
+class AlgorithmParams {
+public:
+    AlgorithmParams() {}
+
+    /**
+     * @brief Parse whitespace separated key=value tokens (tokens without '=' are ignored)
+     * @param text option text, e.g. "s=0 t=5"
+     * @return AlgorithmParams parsed options
+     */
+    static AlgorithmParams parse(const std::string& text);
+
+    void set(const std::string& key, const std::string& value);
+    bool has(const std::string& key) const;
+
+    std::string getString(const std::string& key, const std::string& def = "") const;
+    int getInt(const std::string& key, int def) const;
+    double getDouble(const std::string& key, double def) const;
+    bool getBool(const std::string& key, bool def) const;
+
+    /**
+     * @brief Comma separated integer list, e.g. "pairs=0,5,1,4"
+     * @param key option name
+     * @return std::vector<int> the values, empty if missing
+     */
+    std::vector<int> getIntList(const std::string& key) const;
+
+private:
+    std::map<std::string, std::string> values; ///< Raw option values by key
+};
+
+#endif // ALGORITHM_PARAMS_HPP
@@ -0,0 +1,32 @@
+#include "BFSAlgorithm.hpp"
+#include <string>
+#include <vector>
+
+std::string BFSAlgorithm::run(const Graph::Graph& graph) {
+    return run(graph, AlgorithmParams());
+}
+
+std::string BFSAlgorithm::run(const Graph::Graph& graph, const AlgorithmParams& params) {
+    int n = graph.numOfVertices();
+    int s = params.getInt("s", 0);
+    if (s < 0 || s >= n)
+        return "Invalid source: vertices must be between 0 and " + std::to_string(n - 1);
+
+    std::vector<int> dist = graph.hopDistances(s);
+    int reached = 0, depth = 0;
+    std::string list;
+    list.reserve((size_t)n * 4);
+    for (int v = 0; v < n; ++v) {
+        if (v) list += ", ";
+        if (dist[v] == -1) {
+            list += "-";
+            continue;
+        }
+        ++reached;
+        if (dist[v] > depth) depth = dist[v];
+        list += std::to_string(dist[v]);
+    }
+    return "Hop distances from " + std::to_string(s) + ": " + std::to_string(reached) + " of " +
+           std::to_string(n) + " vertices reached, depth " + std::to_string(depth) +
+           "\n       Distances: " + list;
+}
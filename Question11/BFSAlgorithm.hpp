@@ -0,0 +1,14 @@
+#ifndef BFS_ALGORITHM_HPP
+#define BFS_ALGORITHM_HPP
+
+#include "GraphAlgorithm.hpp"
+
+// Hop distances from one source, computed by Graph::hopDistances (direction-optimizing BFS).
+class BFSAlgorithm : public GraphAlgorithm {
+public:
+    std::string run(const Graph::Graph& graph) override;
+    // Options: s=<source> (default 0)
+    std::string run(const Graph::Graph& graph, const AlgorithmParams& params) override;
+};
+
+#endif // BFS_ALGORITHM_HPP
@@ -0,0 +1,107 @@
+#include "BatchMaxFlowAlgorithm.hpp"
+#include "PushRelabelAlgorithm.hpp"
+#include "ThreadPool.hpp"
+#include <algorithm>
+#include <limits>
+#include <string>
+#include <vector>
+
+std::vector<long long> BatchMaxFlowAlgorithm::maxFlows(const FlowNetwork& base, const std::vector<int>& pairs) const {
+    int count = (int)pairs.size() / 2;
+    std::vector<long long> flows(count, 0);
+    PushRelabelAlgorithm pushRelabel;
+    ThreadPool::shared().parallelFor(0, count, [&](int lo, int hi) {
+        // One private copy per chunk; queries within the chunk only reset capacities.
+        FlowNetwork net(base);
+        for (int i = lo; i < hi; ++i) {
+            if (i > lo) net.reset();
+            flows[i] = pushRelabel.maxFlow(net, pairs[2 * i], pairs[2 * i + 1]);
+        }
+    });
+    return flows;
+}
+
+void BatchMaxFlowAlgorithm::gomoryHuTree(const FlowNetwork& base, std::vector<int>& parent, std::vector<long long>& weight) const {
+    int n = base.numOfVertices();
+    parent.assign(n, 0);
+    weight.assign(n, 0);
+    parent[0] = -1;
+    FlowNetwork net(base);
+    PushRelabelAlgorithm pushRelabel;
+    for (int s = 1; s < n; ++s) {
+        int t = parent[s];
+        net.reset();
+        long long flow = pushRelabel.maxFlow(net, s, t);
+        std::vector<bool> sinkSide = net.sinkSide(t);
+        weight[s] = flow;
+        // Vertices hanging off t move to s if they fell on s's side of the cut.
+        for (int v = 0; v < n; ++v)
+            if (v != s && !sinkSide[v] && parent[v] == t) parent[v] = s;
+        // If t's own parent is on s's side, s takes t's place in the tree.
+        if (parent[t] != -1 && !sinkSide[parent[t]]) {
+            parent[s] = parent[t];
+            parent[t] = s;
+            weight[s] = weight[t];
+            weight[t] = flow;
+        }
+    }
+}
+
+std::string BatchMaxFlowAlgorithm::run(const Graph::Graph& graph) {
+    return run(graph, AlgorithmParams());
+}
+
+std::string BatchMaxFlowAlgorithm::run(const Graph::Graph& graph, const AlgorithmParams& params) {
+    int n = graph.numOfVertices();
+    std::vector<int> pairs = params.getIntList("pairs");
+    if (!params.has("pairs")) {
+        pairs.push_back(0);
+        pairs.push_back(n - 1);
+    }
+    if (pairs.size() % 2 != 0) return "Invalid pairs: expected s1,t1,s2,t2,...";
+    for (size_t i = 0; i < pairs.size(); ++i)
+        if (pairs[i] < 0 || pairs[i] >= n)
+            return "Invalid pairs: vertices must be between 0 and " + std::to_string(n - 1);
+
+    FlowNetwork base(graph);
+    std::string result;
+    std::vector<long long> flows;
+
+    if (params.getBool("gomoryhu", false)) {
+        if (graph.isDirected()) return "Gomory-Hu tree needs an undirected graph";
+        std::vector<int> parent;
+        std::vector<long long> weight;
+        gomoryHuTree(base, parent, weight);
+        result = "Gomory-Hu tree:";
+        for (int v = 1; v < n; ++v)
+            result += "\n       " + std::to_string(v) + " - " + std::to_string(parent[v]) + " (" + std::to_string(weight[v]) + ")";
+
+        // Min cut between u and v = lightest edge on their tree path.
+        std::vector<int> depth(n, -1);
+        depth[0] = 0;
+        for (int v = 1; v < n; ++v) {
+            std::vector<int> path;
+            int u = v;
+            while (depth[u] == -1) { path.push_back(u); u = parent[u]; }
+            for (int i = (int)path.size() - 1; i >= 0; --i) depth[path[i]] = depth[parent[path[i]]] + 1;
+        }
+        for (size_t i = 0; i + 1 < pairs.size(); i += 2) {
+            int u = pairs[i], v = pairs[i + 1];
+            long long cut = u == v ? 0 : std::numeric_limits<long long>::max();
+            while (u != v) {
+                if (depth[u] < depth[v]) std::swap(u, v);
+                cut = std::min(cut, weight[u]);
+                u = parent[u];
+            }
+            flows.push_back(cut);
+        }
+        result += "\n       Pairs (from the tree):";
+    } else {
+        flows = maxFlows(base, pairs);
+        result = "Max flow for " + std::to_string(pairs.size() / 2) + " pairs:";
+    }
+
+    for (size_t i = 0; i + 1 < pairs.size(); i += 2)
+        result += "\n       " + std::to_string(pairs[i]) + "->" + std::to_string(pairs[i + 1]) + ": " + std::to_string(flows[i / 2]);
+    return result;
+}
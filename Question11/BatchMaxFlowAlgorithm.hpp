@@ -0,0 +1,38 @@
+#ifndef BATCH_MAX_FLOW_ALGORITHM_HPP
+#define BATCH_MAX_FLOW_ALGORITHM_HPP
+
+#include "GraphAlgorithm.hpp"
+#include "FlowNetwork.hpp"
+#include <vector>
+
+/**
+ * @brief Max flow for many (s, t) pairs on one graph
+ * @details The residual network is built once; every worker of the shared ThreadPool copies
+ *          it once and resets the capacities in O(E) between its queries. For undirected
+ *          graphs a Gomory-Hu tree (Gusfield's algorithm, n-1 flow computations) can be built
+ *          instead, and every pair is then answered from the tree.
+ */
+class BatchMaxFlowAlgorithm : public GraphAlgorithm {
+public:
+    std::string run(const Graph::Graph& graph) override;
+    // Options: pairs=s1,t1,s2,t2,... (default 0,n-1), gomoryhu=1 (undirected graphs only)
+    std::string run(const Graph::Graph& graph, const AlgorithmParams& params) override;
+
+    /**
+     * @brief Max-flow value for every pair, computed in parallel
+     * @param base residual network with the original capacities (left untouched)
+     * @param pairs flattened (s, t) pairs
+     * @return std::vector<long long> one flow value per pair
+     */
+    std::vector<long long> maxFlows(const FlowNetwork& base, const std::vector<int>& pairs) const;
+
+    /**
+     * @brief Gomory-Hu tree of an undirected network by Gusfield's algorithm
+     * @param base residual network with the original capacities (left untouched)
+     * @param parent filled with the tree parent of each vertex (vertex 0 is the root, parent -1)
+     * @param weight filled with the min-cut value between each vertex and its parent
+     */
+    void gomoryHuTree(const FlowNetwork& base, std::vector<int>& parent, std::vector<long long>& weight) const;
+};
+
+#endif // BATCH_MAX_FLOW_ALGORITHM_HPP
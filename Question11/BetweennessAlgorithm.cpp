@@ -0,0 +1,185 @@
+#include "BetweennessAlgorithm.hpp"
+#include "RadixHeap.hpp"
+#include "ThreadPool.hpp"
+#include <algorithm>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace {
+
+// Per-task scratch space, reused for every source of the task.
+struct Brandes {
+    const Graph::Graph& g;
+    bool weighted;
+    std::vector<long long> dist;
+    std::vector<double> sigma, delta;
+    std::vector<int> order; // vertices in the order they were settled
+    std::vector<char> done;
+
+    Brandes(const Graph::Graph& g, bool weighted)
+        : g(g), weighted(weighted), dist(g.numOfVertices(), -1), sigma(g.numOfVertices(), 0),
+          delta(g.numOfVertices(), 0), done(g.numOfVertices(), 0) {}
+
+    long long weight(int u, int v) const { return weighted ? g.getEdgeWeight(u, v) : 1; }
+
+    void search(int s) {
+        order.clear();
+        dist[s] = 0;
+        sigma[s] = 1;
+        if (!weighted) {
+            order.push_back(s);
+            for (size_t head = 0; head < order.size(); ++head) {
+                int u = order[head];
+                const std::vector<int>& adj = g.neighbors(u);
+                for (size_t i = 0; i < adj.size(); ++i) {
+                    int v = adj[i];
+                    if (dist[v] == -1) {
+                        dist[v] = dist[u] + 1;
+                        order.push_back(v);
+                    }
+                    if (dist[v] == dist[u] + 1) sigma[v] += sigma[u];
+                }
+            }
+            return;
+        }
+        // Dijkstra: sigma[u] is final when u is popped, since all its tight predecessors are closer.
+        RadixHeap heap;
+        heap.push(0, s);
+        while (!heap.empty()) {
+            int u = heap.pop().second;
+            if (done[u]) continue;
+            done[u] = 1;
+            order.push_back(u);
+            const std::vector<int>& adj = g.neighbors(u);
+            for (size_t i = 0; i < adj.size(); ++i) {
+                int v = adj[i];
+                long long nd = dist[u] + weight(u, v);
+                if (dist[v] == -1 || nd < dist[v]) {
+                    dist[v] = nd;
+                    sigma[v] = sigma[u];
+                    heap.push(nd, v);
+                } else if (nd == dist[v]) {
+                    sigma[v] += sigma[u];
+                }
+            }
+        }
+    }
+
+    // Dependencies flow back over the tight edges v -> w, farthest vertices first.
+    void accumulate(int s, std::vector<double>& centrality) {
+        for (size_t i = order.size(); i-- > 0;) {
+            int v = order[i];
+            const std::vector<int>& adj = g.neighbors(v);
+            for (size_t k = 0; k < adj.size(); ++k) {
+                int w = adj[k];
+                if (dist[w] == dist[v] + weight(v, w)) delta[v] += sigma[v] / sigma[w] * (1 + delta[w]);
+            }
+            if (v != s) centrality[v] += delta[v];
+        }
+        for (size_t i = 0; i < order.size(); ++i) {
+            int v = order[i];
+            dist[v] = -1;
+            sigma[v] = 0;
+            delta[v] = 0;
+            done[v] = 0;
+        }
+    }
+};
+
+}
+
+std::vector<double> BetweennessAlgorithm::betweenness(const Graph::Graph& graph, const std::vector<int>& sources,
+                                                      bool weighted) {
+    int n = graph.numOfVertices();
+    std::vector<double> centrality(n, 0.0);
+    if (sources.empty()) return centrality;
+
+    ThreadPool& pool = ThreadPool::shared();
+    int tasks = std::min<int>((int)sources.size(), 4 * (int)pool.size());
+    std::vector<std::vector<double>> partial(tasks);
+    pool.parallelFor(0, tasks, [&](int lo, int hi) {
+        for (int t = lo; t < hi; ++t) {
+            Brandes b(graph, weighted);
+            partial[t].assign(n, 0.0);
+            size_t first = sources.size() * t / tasks, last = sources.size() * (t + 1) / tasks;
+            for (size_t i = first; i < last; ++i) {
+                b.search(sources[i]);
+                b.accumulate(sources[i], partial[t]);
+            }
+        }
+    }, 1);
+
+    double scale = (double)n / sources.size();
+    if (!graph.isDirected()) scale /= 2; // each pair was counted from both ends
+    for (int t = 0; t < tasks; ++t)
+        for (int v = 0; v < n; ++v) centrality[v] += partial[t][v];
+    for (int v = 0; v < n; ++v) centrality[v] *= scale;
+    return centrality;
+}
+
+std::string BetweennessAlgorithm::run(const Graph::Graph& graph) {
+    return run(graph, AlgorithmParams());
+}
+
+std::string BetweennessAlgorithm::run(const Graph::Graph& graph, const AlgorithmParams& params) {
+    int n = graph.numOfVertices();
+
+    // BFS gives the same shortest paths whenever all weights are equal.
+    std::string weightedOpt = params.getString("weighted", "auto");
+    bool weighted;
+    if (weightedOpt == "auto") {
+        int first = 0;
+        weighted = false;
+        for (int u = 0; u < n && !weighted; ++u) {
+            const std::vector<int>& adj = graph.neighbors(u);
+            for (size_t i = 0; i < adj.size() && !weighted; ++i) {
+                int w = graph.getEdgeWeight(u, adj[i]);
+                if (first == 0) first = w;
+                weighted = w != first;
+            }
+        }
+    } else {
+        weighted = params.getBool("weighted", false);
+    }
+    if (weighted) {
+        for (int u = 0; u < n; ++u) {
+            const std::vector<int>& adj = graph.neighbors(u);
+            for (size_t i = 0; i < adj.size(); ++i)
+                if (graph.getEdgeWeight(u, adj[i]) < 0) return "Negative edge weights are not supported";
+        }
+    }
+
+    std::vector<int> sources(n);
+    for (int v = 0; v < n; ++v) sources[v] = v;
+    int samples = params.getInt("samples", 0);
+    bool sampled = samples > 0 && samples < n;
+    if (sampled) {
+        // Partial Fisher-Yates: the first 'samples' entries become a uniform sample.
+        std::mt19937 rng(params.getInt("seed", 1));
+        for (int i = 0; i < samples; ++i) {
+            int j = i + (int)(rng() % (unsigned)(n - i));
+            std::swap(sources[i], sources[j]);
+        }
+        sources.resize(samples);
+        std::sort(sources.begin(), sources.end());
+    }
+
+    std::vector<double> centrality = betweenness(graph, sources, weighted);
+    if (params.getBool("normalized", false) && n > 2) {
+        double norm = (double)(n - 1) * (n - 2);
+        if (!graph.isDirected()) norm /= 2;
+        for (int v = 0; v < n; ++v) centrality[v] /= norm;
+    }
+
+    std::vector<int> top = topVertices(centrality, params.getInt("top", 10));
+
+    std::ostringstream out;
+    out << "Betweenness centrality (" << (weighted ? "dijkstra" : "bfs") << ", ";
+    if (sampled) out << samples << " sampled sources";
+    else out << "exact";
+    out << "), top " << top.size() << ":";
+    for (size_t i = 0; i < top.size(); ++i) out << "\n       " << top[i] << ": " << centrality[top[i]];
+    return out.str();
+}
@@ -0,0 +1,32 @@
+#ifndef BETWEENNESS_ALGORITHM_HPP
+#define BETWEENNESS_ALGORITHM_HPP
+
+#include "GraphAlgorithm.hpp"
+#include <vector>
+
+/**
+ * @brief Betweenness centrality by Brandes' algorithm, parallel over source vertices
+ * @details Every source runs a BFS (all weights equal) or a radix-heap Dijkstra, then
+ *          accumulates dependencies back along the tight edges in reverse settle order.
+ *          Sources are cut into one range per task; each task sums into its own vector and
+ *          the vectors are added in task order, so results do not depend on scheduling.
+ *          With a sample size the sources are drawn at random and the sums scaled by n/k.
+ */
+class BetweennessAlgorithm : public GraphAlgorithm {
+public:
+    std::string run(const Graph::Graph& graph) override;
+    // Options: weighted=auto|0|1, samples=<k> sources (default all), seed=<s>,
+    //          normalized=1, top=<k> vertices to report (10)
+    std::string run(const Graph::Graph& graph, const AlgorithmParams& params) override;
+
+    /**
+     * @brief Betweenness of every vertex (undirected graphs count each pair once)
+     * @param graph source graph
+     * @param sources vertices to run from (all vertices for the exact value)
+     * @param weighted use edge weights (Dijkstra) instead of hop counts (BFS)
+     * @return std::vector<double> centrality per vertex, scaled by n / sources.size()
+     */
+    static std::vector<double> betweenness(const Graph::Graph& graph, const std::vector<int>& sources, bool weighted);
+};
+
+#endif // BETWEENNESS_ALGORITHM_HPP
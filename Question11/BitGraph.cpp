@@ -0,0 +1,34 @@
+#include "BitGraph.hpp"
+
+BitGraph::BitGraph(const Graph::Graph& graph, const std::vector<int>& order)
+    : n((int)order.size()), words((n + WORD_BITS - 1) / WORD_BITS), order(order), bits((size_t)n * words, 0) {
+    std::vector<int> position(graph.numOfVertices(), -1);
+    for (int i = 0; i < n; ++i) position[order[i]] = i;
+    for (int u = 0; u < graph.numOfVertices(); ++u) {
+        if (position[u] < 0) continue;
+        const std::vector<int>& adj = graph.neighbors(u);
+        for (size_t k = 0; k < adj.size(); ++k) {
+            int v = adj[k];
+            if (u > v) continue; // each adjacent pair once, through the edge u -> v with u < v
+            int i = position[u], j = position[v];
+            if (j < 0) continue;
+            bits[(size_t)i * words + j / WORD_BITS] |= 1ULL << (j % WORD_BITS);
+            bits[(size_t)j * words + i / WORD_BITS] |= 1ULL << (i % WORD_BITS);
+        }
+    }
+}
+
+std::vector<std::vector<int>> BitGraph::undirectedNeighbors(const Graph::Graph& graph) {
+    int n = graph.numOfVertices();
+    std::vector<std::vector<int>> adj(n);
+    for (int u = 0; u < n; ++u) {
+        const std::vector<int>& out = graph.neighbors(u);
+        for (size_t k = 0; k < out.size(); ++k) {
+            int v = out[k];
+            if (u > v) continue;
+            adj[u].push_back(v);
+            adj[v].push_back(u);
+        }
+    }
+    return adj;
+}
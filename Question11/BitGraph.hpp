@@ -0,0 +1,53 @@
+#ifndef BIT_GRAPH_HPP
+#define BIT_GRAPH_HPP
+
+#include "Graph.hpp"
+#include <cstddef>
+#include <vector>
+
+/**
+ * @brief Undirected adjacency with one bitset row per vertex, used by the clique engines
+ * @details Vertices are renumbered by a given order (usually the degeneracy order): bit i of a
+ *          row stands for vertex order[i], so "later in the order" is simply "higher bit".
+ *          Two vertices u < v are adjacent when graph.hasEdge(u, v), which is the edge itself
+ *          for undirected graphs and the clique definition CliqueCountAlgorithm always used
+ *          for directed ones.
+ */
+class BitGraph {
+public:
+    typedef unsigned long long Word;
+    static const int WORD_BITS = 64;
+
+    /**
+     * @brief Build the bit rows
+     * @param graph source graph
+     * @param order order[i] is the vertex placed at position i; vertices left out of the order
+     *        are dropped along with their edges
+     */
+    BitGraph(const Graph::Graph& graph, const std::vector<int>& order);
+
+    int size() const { return n; }
+    int numOfWords() const { return words; }
+
+    // Neighbors of the vertex at position i, as positions.
+    const Word* row(int i) const { return &bits[(size_t)i * words]; }
+    bool adjacent(int i, int j) const { return (row(i)[j / WORD_BITS] >> (j % WORD_BITS)) & 1ULL; }
+
+    // Vertex of the original graph at position i.
+    int vertex(int i) const { return order[i]; }
+
+    /**
+     * @brief Undirected neighbor lists under the same adjacency rule
+     * @param graph source graph
+     * @return std::vector<std::vector<int>> neighbors of each vertex
+     */
+    static std::vector<std::vector<int>> undirectedNeighbors(const Graph::Graph& graph);
+
+private:
+    int n;                      ///< Number of positions
+    int words;                  ///< Words per row
+    std::vector<int> order;     ///< Vertex at each position
+    std::vector<Word> bits;     ///< Rows, 'words' words each
+};
+
+#endif // BIT_GRAPH_HPP
@@ -0,0 +1,131 @@
+#include "BridgesAlgorithm.hpp"
+#include <algorithm>
+#include <string>
+#include <vector>
+
+namespace {
+
+struct Frame {
+    int v;          // vertex
+    int entry;      // id of the tree edge into v, -1 for a root
+    int next;       // next arc of v to look at
+};
+
+}
+
+void BridgesAlgorithm::analyze(const Graph::Graph& graph, std::vector<std::pair<int, int>>& bridges,
+                               std::vector<int>& articulation, std::vector<std::vector<int>>& components) {
+    int n = graph.numOfVertices();
+    bridges.clear();
+    articulation.clear();
+    components.clear();
+
+    // Undirected CSR; arc a of edge e leads to head[a], and both arcs of an edge share its id.
+    std::vector<std::pair<int, int>> edges;
+    for (int u = 0; u < n; ++u) {
+        const std::vector<int>& out = graph.neighbors(u);
+        for (size_t i = 0; i < out.size(); ++i) {
+            int v = out[i];
+            if (u < v || (graph.isDirected() && !graph.hasEdge(v, u))) edges.push_back(std::make_pair(u, v));
+        }
+    }
+    std::vector<int> offset(n + 1, 0);
+    for (size_t e = 0; e < edges.size(); ++e) {
+        ++offset[edges[e].first + 1];
+        ++offset[edges[e].second + 1];
+    }
+    for (int v = 0; v < n; ++v) offset[v + 1] += offset[v];
+    std::vector<int> head(offset[n]), id(offset[n]), fill(offset.begin(), offset.end() - 1);
+    for (size_t e = 0; e < edges.size(); ++e) {
+        int u = edges[e].first, v = edges[e].second;
+        head[fill[u]] = v; id[fill[u]++] = (int)e;
+        head[fill[v]] = u; id[fill[v]++] = (int)e;
+    }
+
+    std::vector<int> disc(n, -1), low(n, 0), edgeStack;
+    std::vector<bool> isCut(n, false);
+    std::vector<int> mark(n, -1); // component stamp, to list each vertex once
+    std::vector<Frame> stack;
+    int time = 0;
+    for (int root = 0; root < n; ++root) {
+        if (disc[root] != -1 || offset[root] == offset[root + 1]) continue;
+        disc[root] = low[root] = time++;
+        Frame rootFrame = { root, -1, offset[root] };
+        stack.push_back(rootFrame);
+        int rootChildren = 0;
+        while (!stack.empty()) {
+            Frame& f = stack.back();
+            int v = f.v;
+            if (f.next < offset[v + 1]) {
+                int a = f.next++;
+                int w = head[a];
+                if (id[a] == f.entry) continue;
+                if (disc[w] == -1) {
+                    edgeStack.push_back(id[a]);
+                    disc[w] = low[w] = time++;
+                    if (v == root) ++rootChildren;
+                    Frame child = { w, id[a], offset[w] };
+                    stack.push_back(child); // f is invalid from here on
+                } else if (disc[w] < disc[v]) {
+                    edgeStack.push_back(id[a]); // back edge
+                    low[v] = std::min(low[v], disc[w]);
+                }
+                continue;
+            }
+
+            int entry = f.entry;
+            stack.pop_back();
+            if (stack.empty()) break;
+            int p = stack.back().v;
+            low[p] = std::min(low[p], low[v]);
+            if (low[v] > disc[p]) {
+                bridges.push_back(std::make_pair(std::min(p, v), std::max(p, v)));
+            }
+            if (low[v] >= disc[p]) {
+                if (p != root) isCut[p] = true;
+                // Everything pushed since the tree edge p-v forms one biconnected component.
+                std::vector<int> comp;
+                int stamp = (int)components.size();
+                for (;;) {
+                    int e = edgeStack.back();
+                    edgeStack.pop_back();
+                    int ends[2] = { edges[e].first, edges[e].second };
+                    for (int k = 0; k < 2; ++k)
+                        if (mark[ends[k]] != stamp) {
+                            mark[ends[k]] = stamp;
+                            comp.push_back(ends[k]);
+                        }
+                    if (e == entry) break;
+                }
+                std::sort(comp.begin(), comp.end());
+                components.push_back(comp);
+            }
+        }
+        if (rootChildren >= 2) isCut[root] = true;
+    }
+
+    std::sort(bridges.begin(), bridges.end());
+    for (int v = 0; v < n; ++v)
+        if (isCut[v]) articulation.push_back(v);
+}
+
+std::string BridgesAlgorithm::run(const Graph::Graph& graph) {
+    std::vector<std::pair<int, int>> bridges;
+    std::vector<int> articulation;
+    std::vector<std::vector<int>> components;
+    analyze(graph, bridges, articulation, components);
+
+    std::string result = "Bridges (" + std::to_string(bridges.size()) + "):";
+    for (size_t i = 0; i < bridges.size(); ++i)
+        result += (i ? ", " : " ") + std::to_string(bridges[i].first) + "-" + std::to_string(bridges[i].second);
+    result += "\n       Articulation points (" + std::to_string(articulation.size()) + "):";
+    for (size_t i = 0; i < articulation.size(); ++i)
+        result += (i ? ", " : " ") + std::to_string(articulation[i]);
+    result += "\n       Biconnected components (" + std::to_string(components.size()) + ")";
+    for (size_t c = 0; c < components.size(); ++c) {
+        result += "\n       Component " + std::to_string(c + 1) + ":";
+        for (size_t i = 0; i < components[c].size(); ++i)
+            result += (i ? ", " : " ") + std::to_string(components[c][i]);
+    }
+    return result;
+}
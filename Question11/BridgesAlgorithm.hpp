@@ -0,0 +1,32 @@
+#ifndef BRIDGES_ALGORITHM_HPP
+#define BRIDGES_ALGORITHM_HPP
+
+#include "GraphAlgorithm.hpp"
+#include <utility>
+#include <vector>
+
+/**
+ * @brief Bridges, articulation points and biconnected components in one DFS, O(V+E)
+ * @details Edge direction is ignored (u-v is an edge if either u->v or v->u exists). The DFS
+ *          keeps its own stack of (vertex, entry edge, next arc) frames instead of recursing,
+ *          and computes lowlinks as frames are popped. Tree and back edges go onto an edge
+ *          stack; a child whose lowlink does not reach above its parent closes a biconnected
+ *          component made of the edges pushed since the tree edge to that child.
+ */
+class BridgesAlgorithm : public GraphAlgorithm {
+public:
+    std::string run(const Graph::Graph& graph) override;
+
+    /**
+     * @brief Find the cut edges, cut vertices and biconnected components
+     * @param graph source graph
+     * @param bridges filled with the bridges as (u, v), u < v, ascending
+     * @param articulation filled with the articulation points, ascending
+     * @param components filled with the vertex set of every biconnected component (sorted),
+     *        isolated vertices belong to none
+     */
+    static void analyze(const Graph::Graph& graph, std::vector<std::pair<int, int>>& bridges,
+                        std::vector<int>& articulation, std::vector<std::vector<int>>& components);
+};
+
+#endif // BRIDGES_ALGORITHM_HPP
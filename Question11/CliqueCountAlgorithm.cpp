@@ -1,19 +1,188 @@
 #include "CliqueCountAlgorithm.hpp"
+#include "KCoreAlgorithm.hpp"
+#include <algorithm>
 #include <vector>
 #include <string>
 
+namespace {
+
+typedef BitGraph::Word Word;
+
+inline int lowestBit(Word w) { return __builtin_ctzll(w); }
+inline int popcount(Word w) { return __builtin_popcountll(w); }
+
+// Count the cliques that extend the current one (of 'size' vertices) by vertices of P.
+// P only holds positions after the last vertex added, so every clique is found once,
+// with its vertices in increasing position. scratch[d] is the candidate set at depth d.
+void countFrom(const BitGraph& bg, const Word* P, int fromWord, int size, int maxSize,
+               std::vector<long long>& counts, std::vector<std::vector<Word>>& scratch) {
+    int words = bg.numOfWords();
+    for (int w = fromWord; w < words; ++w) {
+        Word bitsLeft = P[w];
+        while (bitsLeft) {
+            int u = w * BitGraph::WORD_BITS + lowestBit(bitsLeft);
+            bitsLeft &= bitsLeft - 1;
+            ++counts[size + 1];
+            if (size + 1 == maxSize) continue;
+
+            // Q = P & N(u), restricted to positions after u.
+            Word* Q = &scratch[size + 1][0];
+            const Word* row = bg.row(u);
+            bool any = false;
+            Q[w] = bitsLeft & row[w];
+            any = Q[w] != 0;
+            for (int k = w + 1; k < words; ++k) {
+                Q[k] = P[k] & row[k];
+                any = any || Q[k] != 0;
+            }
+            if (any) countFrom(bg, Q, w, size + 1, maxSize, counts, scratch);
+        }
+    }
+}
+
+// Pivoting Bron-Kerbosch (Tomita): R = clique, P = candidates, X = excluded.
+void bronKerbosch(const BitGraph& bg, std::vector<int>& R, std::vector<Word>& P, std::vector<Word>& X,
+                  std::vector<std::vector<int>>& listed, size_t limit, long long& found, int& largest) {
+    int words = bg.numOfWords();
+    bool emptyP = true, emptyX = true;
+    for (int k = 0; k < words; ++k) {
+        if (P[k]) emptyP = false;
+        if (X[k]) emptyX = false;
+    }
+    if (emptyP) {
+        if (emptyX) {
+            ++found;
+            largest = std::max(largest, (int)R.size());
+            if (listed.size() < limit) {
+                std::vector<int> clique;
+                for (size_t i = 0; i < R.size(); ++i) clique.push_back(bg.vertex(R[i]));
+                std::sort(clique.begin(), clique.end());
+                listed.push_back(clique);
+            }
+        }
+        return;
+    }
+
+    // Pivot: the vertex of P u X with the most neighbors in P.
+    int pivot = -1, bestCover = -1;
+    for (int k = 0; k < words; ++k) {
+        Word candidates = P[k] | X[k];
+        while (candidates) {
+            int u = k * BitGraph::WORD_BITS + lowestBit(candidates);
+            candidates &= candidates - 1;
+            const Word* row = bg.row(u);
+            int cover = 0;
+            for (int j = 0; j < words; ++j) cover += popcount(P[j] & row[j]);
+            if (cover > bestCover) { bestCover = cover; pivot = u; }
+        }
+    }
+
+    const Word* pivotRow = bg.row(pivot);
+    std::vector<Word> branch(words), nextP(words), nextX(words);
+    for (int k = 0; k < words; ++k) branch[k] = P[k] & ~pivotRow[k];
+    for (int k = 0; k < words; ++k) {
+        while (branch[k]) {
+            int v = k * BitGraph::WORD_BITS + lowestBit(branch[k]);
+            branch[k] &= branch[k] - 1;
+            const Word* row = bg.row(v);
+            for (int j = 0; j < words; ++j) {
+                nextP[j] = P[j] & row[j];
+                nextX[j] = X[j] & row[j];
+            }
+            R.push_back(v);
+            bronKerbosch(bg, R, nextP, nextX, listed, limit, found, largest);
+            R.pop_back();
+            P[k] &= ~(1ULL << (v % BitGraph::WORD_BITS));
+            X[k] |= 1ULL << (v % BitGraph::WORD_BITS);
+        }
+    }
+}
+
+}
+
+std::vector<long long> CliqueCountAlgorithm::countCliques(const BitGraph& bg, int maxSize) {
+    int n = bg.size(), words = bg.numOfWords();
+    std::vector<long long> counts(maxSize + 1, 0);
+    if (maxSize < 1) return counts;
+    std::vector<std::vector<Word>> scratch(maxSize + 1, std::vector<Word>(words, 0));
+    counts[1] = n;
+    if (maxSize == 1) return counts;
+    for (int i = 0; i < n; ++i) {
+        // Candidates: neighbors after position i (at most 'degeneracy' of them).
+        Word* P = &scratch[1][0];
+        const Word* row = bg.row(i);
+        int w = i / BitGraph::WORD_BITS;
+        Word later = (i % BitGraph::WORD_BITS == BitGraph::WORD_BITS - 1) ? 0 : ~0ULL << (i % BitGraph::WORD_BITS + 1);
+        P[w] = row[w] & later;
+        bool any = P[w] != 0;
+        for (int k = w + 1; k < words; ++k) {
+            P[k] = row[k];
+            any = any || P[k] != 0;
+        }
+        if (any) countFrom(bg, P, w, 1, maxSize, counts, scratch);
+    }
+    return counts;
+}
+
+long long CliqueCountAlgorithm::maximalCliques(const BitGraph& bg, std::vector<std::vector<int>>& listed,
+                                               size_t limit, int& largest) {
+    int n = bg.size(), words = bg.numOfWords();
+    long long found = 0;
+    largest = 0;
+    std::vector<Word> P(words), X(words);
+    std::vector<int> R;
+    // Degeneracy outer loop: start each search at its earliest vertex, with the later
+    // neighbors as candidates and the earlier ones excluded.
+    for (int i = 0; i < n; ++i) {
+        const Word* row = bg.row(i);
+        for (int k = 0; k < words; ++k) {
+            Word later;
+            if (k < i / BitGraph::WORD_BITS) later = 0;
+            else if (k > i / BitGraph::WORD_BITS) later = ~0ULL;
+            else later = (i % BitGraph::WORD_BITS == BitGraph::WORD_BITS - 1) ? 0 : ~0ULL << (i % BitGraph::WORD_BITS + 1);
+            P[k] = row[k] & later;
+            X[k] = row[k] & ~later;
+        }
+        R.assign(1, i);
+        bronKerbosch(bg, R, P, X, listed, limit, found, largest);
+    }
+    return found;
+}
+
 std::string CliqueCountAlgorithm::run(const Graph::Graph& graph) {
-    int n = graph.numOfVertices();
-    int count = 0;
-    for (int mask = 1; mask < (1 << n); ++mask) {
-        std::vector<int> nodes;
-        for (int i = 0; i < n; ++i) if (mask & (1 << i)) nodes.push_back(i);
-        if (nodes.size() < 2 || nodes.size() > 5) continue;
-        bool isClique = true;
-        for (size_t i = 0; i < nodes.size(); ++i)
-            for (size_t j = i + 1; j < nodes.size(); ++j)
-                if (!graph.hasEdge(nodes[i], nodes[j])) isClique = false;
-        if (isClique) ++count;
-    }
-    return "Number of cliques (size 2-5): " + std::to_string(count);
+    return run(graph, AlgorithmParams());
+}
+
+std::string CliqueCountAlgorithm::run(const Graph::Graph& graph, const AlgorithmParams& params) {
+    int minSize = params.getInt("min", 2), maxSize = params.getInt("max", 5);
+    if (minSize < 1 || maxSize < minSize)
+        return "Invalid clique sizes: need 1 <= min <= max";
+    std::vector<int> core, order;
+    KCoreAlgorithm::coreNumbers(graph, core, &order);
+
+    // Cliques of at least min vertices live in the (min-1)-core; counting skips everything else.
+    std::vector<long long> counts = countCliques(BitGraph(graph, KCoreAlgorithm::innerCore(order, core, minSize - 1)),
+                                                 maxSize);
+    long long count = 0;
+    for (int k = minSize; k <= maxSize; ++k) count += counts[k];
+    std::string result = "Number of cliques (size " + std::to_string(minSize) + "-" + std::to_string(maxSize) + "): " +
+                         std::to_string(count);
+
+    if (params.getBool("maximal", false)) {
+        int limit = std::max(0, params.getInt("limit", 100));
+        std::vector<std::vector<int>> listed;
+        int largest = 0;
+        long long maximal = maximalCliques(BitGraph(graph, order), listed, (size_t)limit, largest);
+        result += "\n       Maximal cliques: " + std::to_string(maximal) + " (largest has " + std::to_string(largest) + " vertices)";
+        for (size_t i = 0; i < listed.size(); ++i) {
+            result += "\n       {";
+            for (size_t j = 0; j < listed[i].size(); ++j) {
+                if (j) result += ", ";
+                result += std::to_string(listed[i][j]);
+            }
+            result += "}";
+        }
+        if ((long long)listed.size() < maximal) result += "\n       ...";
+    }
+    return result;
 }
@@ -2,10 +2,25 @@
 #define CLIQUE_COUNT_ALGORITHM_HPP
 
 #include "GraphAlgorithm.hpp"
+#include "BitGraph.hpp"
+#include <vector>
 
+// Bron-Kerbosch style clique engine over BitGraph rows in degeneracy order.
 class CliqueCountAlgorithm : public GraphAlgorithm {
 public:
     std::string run(const Graph::Graph& graph) override;
+    // Options: min=<k> max=<k> clique sizes to count (default 2-5),
+    //          maximal=1 also enumerates the maximal cliques (pivoting Bron-Kerbosch),
+    //          limit=<k> caps how many of them are listed (default 100)
+    std::string run(const Graph::Graph& graph, const AlgorithmParams& params) override;
+
+    // counts[k] = number of cliques with k vertices, for k = 1..maxSize.
+    static std::vector<long long> countCliques(const BitGraph& bg, int maxSize);
+
+    // Number of maximal cliques; the first 'limit' of them (as graph vertices) go to 'listed'
+    // and the size of the largest one to 'largest'.
+    static long long maximalCliques(const BitGraph& bg, std::vector<std::vector<int>>& listed,
+                                    size_t limit, int& largest);
 };
 
 #endif // CLIQUE_COUNT_ALGORITHM_HPP
@@ -0,0 +1,28 @@
+#include "ClosureAlgorithm.hpp"
+#include "ReachabilityIndex.hpp"
+#include <string>
+#include <vector>
+
+std::string ClosureAlgorithm::run(const Graph::Graph& graph) {
+    return run(graph, AlgorithmParams());
+}
+
+std::string ClosureAlgorithm::run(const Graph::Graph& graph, const AlgorithmParams& params) {
+    int n = graph.numOfVertices();
+    std::vector<int> queries = params.getIntList("queries");
+    if (queries.size() % 2 != 0) return "Invalid queries: expected u1,v1,u2,v2,...";
+    for (size_t i = 0; i < queries.size(); ++i)
+        if (queries[i] < 0 || queries[i] >= n)
+            return "Invalid queries: vertices must be between 0 and " + std::to_string(n - 1);
+
+    ReachabilityIndex index(graph);
+    long long pairs = 0;
+    for (int v = 0; v < n; ++v) pairs += index.reachableFrom(v) - 1;
+    std::string result = "Transitive closure: " + std::to_string(pairs) + " reachable pairs (u != v) over " +
+                         std::to_string(index.condensation().count) + " components";
+    for (size_t i = 0; i < queries.size(); i += 2) {
+        result += "\n       " + std::to_string(queries[i]) + "->" + std::to_string(queries[i + 1]) + ": ";
+        result += index.reaches(queries[i], queries[i + 1]) ? "yes" : "no";
+    }
+    return result;
+}
@@ -0,0 +1,14 @@
+#ifndef CLOSURE_ALGORITHM_HPP
+#define CLOSURE_ALGORITHM_HPP
+
+#include "GraphAlgorithm.hpp"
+
+// Transitive closure through a ReachabilityIndex; reachability queries are O(1) each.
+class ClosureAlgorithm : public GraphAlgorithm {
+public:
+    std::string run(const Graph::Graph& graph) override;
+    // Options: queries=u1,v1,u2,v2,... answer "can u reach v" for each pair
+    std::string run(const Graph::Graph& graph, const AlgorithmParams& params) override;
+};
+
+#endif // CLOSURE_ALGORITHM_HPP
@@ -0,0 +1,324 @@
+#include "CommunityAlgorithm.hpp"
+#include "BitGraph.hpp"
+#include "ThreadPool.hpp"
+#include <algorithm>
+#include <random>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace {
+
+typedef std::pair<int, double> GroupWeight;
+
+// Symmetric adjacency in CSR form. Self loops are kept apart in 'loop': loop[v] is A(v,v),
+// the weight of the edges folded into v when communities are merged, counted both ways.
+struct WeightedGraph {
+    int n;
+    std::vector<int> offset, target;
+    std::vector<double> weight, loop;
+    std::vector<double> degree; // sum of row v of A, loop included
+    double total;               // sum of all degrees (2m)
+
+    void finish() {
+        degree.assign(n, 0);
+        total = 0;
+        for (int v = 0; v < n; ++v) {
+            degree[v] = loop[v];
+            for (int e = offset[v]; e < offset[v + 1]; ++e) degree[v] += weight[e];
+            total += degree[v];
+        }
+    }
+};
+
+WeightedGraph fromGraph(const Graph::Graph& graph, bool weighted) {
+    std::vector<std::vector<int>> adj = BitGraph::undirectedNeighbors(graph);
+    WeightedGraph g;
+    g.n = graph.numOfVertices();
+    g.offset.assign(g.n + 1, 0);
+    g.loop.assign(g.n, 0);
+    for (int v = 0; v < g.n; ++v) {
+        for (size_t i = 0; i < adj[v].size(); ++i) {
+            int u = adj[v][i];
+            g.target.push_back(u);
+            g.weight.push_back(weighted ? graph.getEdgeWeight(std::min(u, v), std::max(u, v)) : 1.0);
+        }
+        g.offset[v + 1] = (int)g.target.size();
+    }
+    g.finish();
+    return g;
+}
+
+// Greedy coloring in a seeded random order; each class lists its vertices in that order.
+std::vector<std::vector<int>> colorClasses(const WeightedGraph& g, std::mt19937& rng) {
+    std::vector<int> order(g.n), color(g.n, -1), seen;
+    for (int v = 0; v < g.n; ++v) order[v] = v;
+    std::shuffle(order.begin(), order.end(), rng);
+    std::vector<std::vector<int>> classes;
+    for (int i = 0; i < g.n; ++i) {
+        int v = order[i];
+        // seen[c] == v marks the colors of v's neighbors.
+        for (int e = g.offset[v]; e < g.offset[v + 1]; ++e)
+            if (color[g.target[e]] >= 0) seen[color[g.target[e]]] = v;
+        int c = 0;
+        while (c < (int)seen.size() && seen[c] == v) ++c;
+        if (c == (int)classes.size()) {
+            classes.push_back(std::vector<int>());
+            seen.push_back(-1);
+        }
+        color[v] = c;
+        classes[c].push_back(v);
+    }
+    return classes;
+}
+
+// Edge weight from v into each group of its neighbors, groups ascending.
+void groupWeights(const WeightedGraph& g, int v, const std::vector<int>& group, std::vector<GroupWeight>& out) {
+    out.clear();
+    for (int e = g.offset[v]; e < g.offset[v + 1]; ++e) out.push_back(GroupWeight(group[g.target[e]], g.weight[e]));
+    std::sort(out.begin(), out.end());
+    size_t k = 0;
+    for (size_t i = 0; i < out.size(); ++i) {
+        if (k > 0 && out[k - 1].first == out[i].first) out[k - 1].second += out[i].second;
+        else out[k++] = out[i];
+    }
+    out.resize(k);
+}
+
+// Renumber to 0..k-1 in order of the smallest member; returns k.
+int renumber(std::vector<int>& community) {
+    std::vector<int> id(community.size(), -1);
+    int k = 0;
+    for (size_t v = 0; v < community.size(); ++v) {
+        if (id[community[v]] < 0) id[community[v]] = k++;
+        community[v] = id[community[v]];
+    }
+    return k;
+}
+
+double modularityOf(const WeightedGraph& g, const std::vector<int>& community) {
+    if (g.total <= 0) return 0;
+    std::vector<double> inside(g.n, 0), tot(g.n, 0);
+    for (int v = 0; v < g.n; ++v) {
+        int c = community[v];
+        tot[c] += g.degree[v];
+        inside[c] += g.loop[v];
+        for (int e = g.offset[v]; e < g.offset[v + 1]; ++e)
+            if (community[g.target[e]] == c) inside[c] += g.weight[e];
+    }
+    double q = 0;
+    for (int c = 0; c < g.n; ++c) q += inside[c] / g.total - (tot[c] / g.total) * (tot[c] / g.total);
+    return q;
+}
+
+// One vertex per community; edges between communities are summed, edges inside become loops.
+WeightedGraph aggregate(const WeightedGraph& g, const std::vector<int>& community, int k) {
+    std::vector<std::vector<int>> members(k);
+    for (int v = 0; v < g.n; ++v) members[community[v]].push_back(v);
+
+    std::vector<std::vector<GroupWeight>> rows(k);
+    WeightedGraph a;
+    a.n = k;
+    a.loop.assign(k, 0);
+    ThreadPool::shared().parallelFor(0, k, [&](int lo, int hi) {
+        std::vector<GroupWeight> part;
+        for (int c = lo; c < hi; ++c) {
+            std::vector<GroupWeight>& row = rows[c];
+            for (size_t i = 0; i < members[c].size(); ++i) {
+                int v = members[c][i];
+                a.loop[c] += g.loop[v];
+                groupWeights(g, v, community, part);
+                row.insert(row.end(), part.begin(), part.end());
+            }
+            std::sort(row.begin(), row.end());
+            size_t m = 0;
+            for (size_t i = 0; i < row.size(); ++i) {
+                if (row[i].first == c) a.loop[c] += row[i].second;
+                else if (m > 0 && row[m - 1].first == row[i].first) row[m - 1].second += row[i].second;
+                else row[m++] = row[i];
+            }
+            row.resize(m);
+        }
+    }, 64);
+
+    a.offset.assign(k + 1, 0);
+    for (int c = 0; c < k; ++c) {
+        for (size_t i = 0; i < rows[c].size(); ++i) {
+            a.target.push_back(rows[c][i].first);
+            a.weight.push_back(rows[c][i].second);
+        }
+        a.offset[c + 1] = (int)a.target.size();
+    }
+    a.finish();
+    return a;
+}
+
+}
+
+double CommunityAlgorithm::labelPropagation(const Graph::Graph& graph, bool weighted, unsigned seed, int maxIter,
+                                            std::vector<int>& community) {
+    WeightedGraph g = fromGraph(graph, weighted);
+    std::mt19937 rng(seed);
+    std::vector<std::vector<int>> classes = colorClasses(g, rng);
+
+    // Ties between equally heavy labels go to the higher seeded priority, unless the
+    // current label is one of them.
+    std::vector<int> priority(g.n);
+    for (int v = 0; v < g.n; ++v) priority[v] = v;
+    std::shuffle(priority.begin(), priority.end(), rng);
+
+    std::vector<int>& label = community;
+    label.resize(g.n);
+    for (int v = 0; v < g.n; ++v) label[v] = v;
+    std::vector<char> changed(g.n);
+    for (int iter = 0; iter < maxIter; ++iter) {
+        bool any = false;
+        for (size_t c = 0; c < classes.size(); ++c) {
+            const std::vector<int>& cls = classes[c];
+            ThreadPool::shared().parallelFor(0, (int)cls.size(), [&](int lo, int hi) {
+                std::vector<GroupWeight> around;
+                for (int i = lo; i < hi; ++i) {
+                    int v = cls[i];
+                    groupWeights(g, v, label, around);
+                    int best = label[v];
+                    double bestWeight = -1;
+                    for (size_t k = 0; k < around.size(); ++k) {
+                        int l = around[k].first;
+                        double w = around[k].second;
+                        bool tieWon = w == bestWeight && best != label[v] &&
+                                      (l == label[v] || priority[l] > priority[best]);
+                        if (w > bestWeight || tieWon) {
+                            best = l;
+                            bestWeight = w;
+                        }
+                    }
+                    changed[v] = best != label[v];
+                    label[v] = best;
+                }
+            }, 256);
+            for (size_t i = 0; i < cls.size(); ++i) any = any || changed[cls[i]];
+        }
+        if (!any) break;
+    }
+    renumber(label);
+    return modularityOf(g, label);
+}
+
+double CommunityAlgorithm::louvain(const Graph::Graph& graph, bool weighted, unsigned seed, int maxIter,
+                                   std::vector<int>& community) {
+    WeightedGraph base = fromGraph(graph, weighted);
+    community.resize(base.n);
+    for (int v = 0; v < base.n; ++v) community[v] = v;
+    if (base.total <= 0) return 0;
+
+    std::mt19937 rng(seed);
+    WeightedGraph g = base;
+    while (true) {
+        std::vector<int> local(g.n);
+        std::vector<double> tot(g.degree);
+        for (int v = 0; v < g.n; ++v) local[v] = v;
+        std::vector<std::vector<int>> classes = colorClasses(g, rng);
+
+        // Local moving. A class decides on the community totals left by the previous class and
+        // then applies its moves; its members share no edges, so their edge weights stay exact.
+        bool movedAtAll = false;
+        double q = modularityOf(g, local);
+        std::vector<int> choice(g.n);
+        for (int pass = 0; pass < maxIter; ++pass) {
+            bool moved = false;
+            for (size_t c = 0; c < classes.size(); ++c) {
+                const std::vector<int>& cls = classes[c];
+                ThreadPool::shared().parallelFor(0, (int)cls.size(), [&](int lo, int hi) {
+                    std::vector<GroupWeight> around;
+                    for (int i = lo; i < hi; ++i) {
+                        int v = cls[i], from = local[v];
+                        double k = g.degree[v];
+                        groupWeights(g, v, local, around);
+                        // Gain of joining a community, up to a common factor, with v taken out of its own.
+                        double stay = -(tot[from] - k) * k / g.total;
+                        for (size_t j = 0; j < around.size(); ++j)
+                            if (around[j].first == from) stay += around[j].second;
+                        int best = from;
+                        double bestGain = stay;
+                        for (size_t j = 0; j < around.size(); ++j) {
+                            if (around[j].first == from) continue;
+                            double gain = around[j].second - tot[around[j].first] * k / g.total;
+                            if (gain > bestGain) {
+                                best = around[j].first;
+                                bestGain = gain;
+                            }
+                        }
+                        choice[v] = best;
+                    }
+                }, 256);
+                for (size_t i = 0; i < cls.size(); ++i) {
+                    int v = cls[i];
+                    if (choice[v] == local[v]) continue;
+                    tot[local[v]] -= g.degree[v];
+                    tot[choice[v]] += g.degree[v];
+                    local[v] = choice[v];
+                    moved = true;
+                }
+            }
+            if (!moved) break;
+            movedAtAll = true;
+            double next = modularityOf(g, local);
+            bool improved = next - q > 1e-10;
+            q = next;
+            if (!improved) break;
+        }
+        if (!movedAtAll) break;
+
+        int k = renumber(local);
+        for (size_t v = 0; v < community.size(); ++v) community[v] = local[community[v]];
+        if (k == g.n) break;
+        g = aggregate(g, local, k);
+    }
+    renumber(community);
+    return modularityOf(base, community);
+}
+
+double CommunityAlgorithm::modularity(const Graph::Graph& graph, bool weighted, const std::vector<int>& community) {
+    std::vector<int> ids(community);
+    renumber(ids);
+    return modularityOf(fromGraph(graph, weighted), ids);
+}
+
+std::string CommunityAlgorithm::run(const Graph::Graph& graph) {
+    return run(graph, AlgorithmParams());
+}
+
+std::string CommunityAlgorithm::run(const Graph::Graph& graph, const AlgorithmParams& params) {
+    int n = graph.numOfVertices();
+    bool weighted = params.getBool("weighted", false);
+    if (weighted) {
+        for (int u = 0; u < n; ++u) {
+            const std::vector<int>& adj = graph.neighbors(u);
+            for (size_t i = 0; i < adj.size(); ++i)
+                if (graph.getEdgeWeight(u, adj[i]) < 0) return "Negative edge weights are not supported";
+        }
+    }
+    unsigned seed = (unsigned)params.getInt("seed", 1);
+    int maxIter = params.getInt("maxiter", 100);
+
+    std::string mode = params.getString("mode", "louvain");
+    std::vector<int> community;
+    double q;
+    if (mode == "louvain") q = louvain(graph, weighted, seed, maxIter, community);
+    else if (mode == "lpa") q = labelPropagation(graph, weighted, seed, maxIter, community);
+    else return "Unknown mode: " + mode + " (use louvain or lpa)";
+
+    int k = 0;
+    for (int v = 0; v < n; ++v) k = std::max(k, community[v] + 1);
+    std::vector<std::vector<int>> members(k);
+    for (int v = 0; v < n; ++v) members[community[v]].push_back(v);
+
+    std::ostringstream out;
+    out << "Communities (" << mode << "): " << k << ", modularity " << q;
+    for (int c = 0; c < k; ++c) {
+        out << "\n       Community " << c + 1 << ":";
+        for (size_t i = 0; i < members[c].size(); ++i) out << (i ? ", " : " ") << members[c][i];
+    }
+    return out.str();
+}
@@ -0,0 +1,35 @@
+#ifndef COMMUNITY_ALGORITHM_HPP
+#define COMMUNITY_ALGORITHM_HPP
+
+#include "GraphAlgorithm.hpp"
+#include <vector>
+
+/**
+ * @brief Community detection by label propagation or Louvain modularity optimization
+ * @details Both work on the undirected view of the graph (BitGraph adjacency rule) and update
+ *          vertices one greedy color class at a time: the members of a class are never
+ *          adjacent, so each class is processed on the shared ThreadPool and gives the same
+ *          result as a sequential sweep, whatever the scheduling. The seed fixes the coloring
+ *          order and the tie-breaking, so a run is reproducible.
+ *          Label propagation moves each vertex to the heaviest label around it. Louvain moves
+ *          vertices to the neighboring community with the largest modularity gain, then merges
+ *          every community into one vertex and repeats until nothing moves.
+ */
+class CommunityAlgorithm : public GraphAlgorithm {
+public:
+    std::string run(const Graph::Graph& graph) override;
+    // Options: mode=louvain|lpa (default louvain), seed=<s> (1), weighted=1 uses edge weights,
+    //          maxiter=<k> sweeps per level (100)
+    std::string run(const Graph::Graph& graph, const AlgorithmParams& params) override;
+
+    // Both fill community[v] with ids 0..k-1 (numbered by smallest vertex) and return the modularity.
+    static double labelPropagation(const Graph::Graph& graph, bool weighted, unsigned seed, int maxIter,
+                                   std::vector<int>& community);
+    static double louvain(const Graph::Graph& graph, bool weighted, unsigned seed, int maxIter,
+                          std::vector<int>& community);
+
+    // Newman modularity of a partition with ids in 0..n-1 (0 for a graph without edges).
+    static double modularity(const Graph::Graph& graph, bool weighted, const std::vector<int>& community);
+};
+
+#endif // COMMUNITY_ALGORITHM_HPP
@@ -0,0 +1,43 @@
+#include "ComponentsAlgorithm.hpp"
+#include <string>
+#include <vector>
+
+std::string ComponentsAlgorithm::run(const Graph::Graph& graph) {
+    return run(graph, AlgorithmParams());
+}
+
+std::string ComponentsAlgorithm::run(const Graph::Graph& graph, const AlgorithmParams& params) {
+    const UnionFind& uf = graph.components();
+    int n = uf.numOfElements();
+
+    // Sizes come straight from the roots, in order of their smallest vertex.
+    std::vector<int> id(n, -1);
+    std::vector<int> sizes;
+    int largest = 0;
+    for (int v = 0; v < n; ++v) {
+        int r = uf.root(v);
+        if (id[r] != -1) continue;
+        id[r] = (int)sizes.size();
+        sizes.push_back(uf.size(r));
+        if (sizes.back() > largest) largest = sizes.back();
+    }
+
+    std::string result = "Number of connected components: " + std::to_string(uf.count()) +
+                         ", largest has " + std::to_string(largest) + " vertices\n       Sizes: ";
+    for (size_t c = 0; c < sizes.size(); ++c) {
+        if (c) result += ", ";
+        result += std::to_string(sizes[c]);
+    }
+    if (!params.getBool("list", false)) return result;
+
+    std::vector<std::vector<int>> members(sizes.size());
+    for (int v = 0; v < n; ++v) members[id[uf.root(v)]].push_back(v);
+    for (size_t c = 0; c < members.size(); ++c) {
+        result += "\n       Component " + std::to_string(c + 1) + ": ";
+        for (size_t i = 0; i < members[c].size(); ++i) {
+            if (i) result += ", ";
+            result += std::to_string(members[c][i]);
+        }
+    }
+    return result;
+}
@@ -0,0 +1,15 @@
+#ifndef COMPONENTS_ALGORITHM_HPP
+#define COMPONENTS_ALGORITHM_HPP
+
+#include "GraphAlgorithm.hpp"
+
+// Connected components (edge direction ignored) read from the union-find the graph builds
+// while its edges are added - no traversal happens here.
+class ComponentsAlgorithm : public GraphAlgorithm {
+public:
+    std::string run(const Graph::Graph& graph) override;
+    // Options: list=1 also lists the vertices of each component (numbered by smallest vertex)
+    std::string run(const Graph::Graph& graph, const AlgorithmParams& params) override;
+};
+
+#endif // COMPONENTS_ALGORITHM_HPP
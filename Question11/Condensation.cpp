@@ -0,0 +1,77 @@
+#include "Condensation.hpp"
+#include <cstddef>
+
+namespace {
+
+const char* BASE64 = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+void putVarint(std::string& out, unsigned int v) {
+    while (v >= 0x80) {
+        out += (char)((v & 0x7F) | 0x80);
+        v >>= 7;
+    }
+    out += (char)v;
+}
+
+std::string toBase64(const std::string& bytes) {
+    std::string out;
+    out.reserve((bytes.size() + 2) / 3 * 4);
+    for (size_t i = 0; i < bytes.size(); i += 3) {
+        unsigned int chunk = (unsigned char)bytes[i] << 16;
+        if (i + 1 < bytes.size()) chunk |= (unsigned char)bytes[i + 1] << 8;
+        if (i + 2 < bytes.size()) chunk |= (unsigned char)bytes[i + 2];
+        out += BASE64[(chunk >> 18) & 63];
+        out += BASE64[(chunk >> 12) & 63];
+        out += i + 1 < bytes.size() ? BASE64[(chunk >> 6) & 63] : '=';
+        out += i + 2 < bytes.size() ? BASE64[chunk & 63] : '=';
+    }
+    return out;
+}
+
+}
+
+void Condensation::setEdges(const std::vector<std::pair<int, int>>& edges) {
+    // Counting sort by target, then a stable one by source: rows come out ascending.
+    std::vector<int> byTarget(edges.size());
+    std::vector<int> start(count + 1, 0);
+    for (size_t i = 0; i < edges.size(); ++i) ++start[edges[i].second + 1];
+    for (int c = 0; c < count; ++c) start[c + 1] += start[c];
+    for (size_t i = 0; i < edges.size(); ++i) byTarget[start[edges[i].second]++] = (int)i;
+
+    std::vector<int> rowStart(count + 1, 0);
+    for (size_t i = 0; i < edges.size(); ++i) ++rowStart[edges[i].first + 1];
+    for (int c = 0; c < count; ++c) rowStart[c + 1] += rowStart[c];
+    std::vector<int> sorted(edges.size());
+    std::vector<int> pos(rowStart.begin(), rowStart.end() - 1);
+    for (size_t i = 0; i < byTarget.size(); ++i) {
+        const std::pair<int, int>& e = edges[byTarget[i]];
+        sorted[pos[e.first]++] = e.second;
+    }
+
+    // Drop duplicates within each (sorted) row.
+    offset.assign(count + 1, 0);
+    target.clear();
+    target.reserve(sorted.size());
+    for (int c = 0; c < count; ++c) {
+        for (int i = rowStart[c]; i < rowStart[c + 1]; ++i)
+            if (i == rowStart[c] || sorted[i] != sorted[i - 1]) target.push_back(sorted[i]);
+        offset[c + 1] = (int)target.size();
+    }
+}
+
+std::string Condensation::encode() const {
+    std::string bytes;
+    bytes.reserve(comp.size() + target.size() + count + 8);
+    putVarint(bytes, (unsigned int)comp.size());
+    putVarint(bytes, (unsigned int)count);
+    for (size_t v = 0; v < comp.size(); ++v) putVarint(bytes, (unsigned int)comp[v]);
+    for (int c = 0; c < count; ++c) {
+        putVarint(bytes, (unsigned int)(offset[c + 1] - offset[c]));
+        int prev = 0;
+        for (int i = offset[c]; i < offset[c + 1]; ++i) {
+            putVarint(bytes, (unsigned int)(target[i] - prev));
+            prev = target[i];
+        }
+    }
+    return toBase64(bytes);
+}
@@ -0,0 +1,39 @@
+#ifndef CONDENSATION_HPP
+#define CONDENSATION_HPP
+
+#include <string>
+#include <utility>
+#include <vector>
+
+/**
+ * @brief SCC labeling of a graph together with its condensation DAG
+ * @details Components are numbered by their smallest vertex. The DAG is stored in CSR form:
+ *          the successors of component c are target[offset[c]] .. target[offset[c+1]-1],
+ *          ascending and without duplicates, so two engines that find the same components
+ *          also produce the same Condensation.
+ */
+struct Condensation {
+    int count;                  ///< Number of components
+    std::vector<int> comp;      ///< Component of each vertex
+    std::vector<int> offset;    ///< DAG CSR offsets, size count+1
+    std::vector<int> target;    ///< Successor components
+
+    Condensation() : count(0) {}
+
+    /**
+     * @brief Build the DAG CSR from component edges in O(count + edges)
+     * @param edges (from, to) component pairs - duplicates are allowed, from != to
+     */
+    void setEdges(const std::vector<std::pair<int, int>>& edges);
+
+    /**
+     * @brief Compact wire form of the labeling and the DAG
+     * @details LEB128 varints: n, count, comp[0..n-1], then per component its successor count
+     *          followed by the delta-coded successors. The bytes are base64 encoded so the
+     *          result stays a single line of the text reply.
+     * @return std::string base64 text
+     */
+    std::string encode() const;
+};
+
+#endif // CONDENSATION_HPP
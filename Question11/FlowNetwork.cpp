@@ -0,0 +1,51 @@
+#include "FlowNetwork.hpp"
+#include <cstddef>
+#include <vector>
+
+FlowNetwork::FlowNetwork(const Graph::Graph& graph) : n(graph.numOfVertices()), first(n + 1, 0) {
+    // First pass: count the arcs leaving each vertex (one per pair touching it).
+    for (int u = 0; u < n; ++u)
+        for (int v = u + 1; v < n; ++v)
+            if (graph.hasEdge(u, v) || graph.hasEdge(v, u)) {
+                ++first[u + 1];
+                ++first[v + 1];
+            }
+    for (int v = 0; v < n; ++v) first[v + 1] += first[v];
+
+    // Second pass: place each arc and its reverse.
+    arcs.resize(first[n]);
+    original.resize(first[n]);
+    std::vector<int> pos(first.begin(), first.end() - 1);
+    for (int u = 0; u < n; ++u)
+        for (int v = u + 1; v < n; ++v)
+            if (graph.hasEdge(u, v) || graph.hasEdge(v, u)) {
+                int a = pos[u]++, b = pos[v]++;
+                arcs[a].to = v; arcs[a].rev = b; arcs[a].cap = graph.getEdgeWeight(u, v);
+                arcs[b].to = u; arcs[b].rev = a; arcs[b].cap = graph.getEdgeWeight(v, u);
+                original[a] = arcs[a].cap;
+                original[b] = arcs[b].cap;
+            }
+}
+
+void FlowNetwork::reset() {
+    for (size_t i = 0; i < arcs.size(); ++i) arcs[i].cap = original[i];
+}
+
+std::vector<bool> FlowNetwork::sinkSide(int t) const {
+    std::vector<bool> reaches(n, false);
+    std::vector<int> queue;
+    queue.reserve(n);
+    queue.push_back(t);
+    reaches[t] = true;
+    for (size_t head = 0; head < queue.size(); ++head) {
+        int v = queue[head];
+        for (int a = first[v]; a < first[v + 1]; ++a) {
+            int u = arcs[a].to;
+            if (!reaches[u] && arcs[arcs[a].rev].cap > 0) {
+                reaches[u] = true;
+                queue.push_back(u);
+            }
+        }
+    }
+    return reaches;
+}
@@ -0,0 +1,64 @@
+#ifndef FLOW_NETWORK_HPP
+#define FLOW_NETWORK_HPP
+
+#include "Graph.hpp"
+#include <vector>
+
+/**
+ * @brief Residual network for the max-flow strategies, built once from a Graph
+ * @details Every vertex pair {u, v} that has capacity in at least one direction becomes an
+ *          arc u->v and its paired reverse arc v->u, so antiparallel edges share one pair.
+ *          Arcs are stored contiguously per tail vertex (CSR layout): the arcs leaving v are
+ *          arcs[first[v]] .. arcs[first[v+1]-1]. The original capacities are kept aside so
+ *          the network can be reused for another query after reset().
+ */
+class FlowNetwork {
+public:
+    struct Arc {
+        int to;         ///< Head vertex
+        int rev;        ///< Index of the paired reverse arc
+        long long cap;  ///< Residual capacity
+    };
+
+    /**
+     * @brief Build the residual network from the edge weights of a graph
+     * @param graph source graph - edge weights are used as capacities
+     */
+    explicit FlowNetwork(const Graph::Graph& graph);
+
+    /**
+     * @brief Restore every residual capacity to its original value in O(E)
+     */
+    void reset();
+
+    int numOfVertices() const { return n; }
+    int numOfArcs() const { return (int)arcs.size(); }
+
+    int arcBegin(int v) const { return first[v]; }
+    int arcEnd(int v) const { return first[v + 1]; }
+
+    Arc& arc(int i) { return arcs[i]; }
+    const Arc& arc(int i) const { return arcs[i]; }
+
+    /**
+     * @brief Original (pre-flow) capacity of an arc
+     * @param i arc index
+     * @return long long capacity, 0 for the reverse arc of a one-way edge
+     */
+    long long capacity(int i) const { return original[i]; }
+
+    /**
+     * @brief Vertices that can still reach t over arcs with residual capacity
+     * @param t sink vertex
+     * @return std::vector<bool> true for the sink side of the min cut once the flow is maximal
+     */
+    std::vector<bool> sinkSide(int t) const;
+
+private:
+    int n;                          ///< Number of vertices
+    std::vector<int> first;         ///< CSR offsets, size n+1
+    std::vector<Arc> arcs;          ///< Arcs grouped by tail vertex
+    std::vector<long long> original;///< Capacities before any flow was pushed
+};
+
+#endif // FLOW_NETWORK_HPP
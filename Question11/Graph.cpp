@@ -2,8 +2,7 @@
 #include <vector>
 #include <iostream>
 #include <algorithm>
-#include <queue>
-#include <stack>
+#include <utility>
 
 namespace Graph {
 
@@ -13,11 +12,15 @@ namespace Graph {
             n = 1;
         }
         adjMatrix.resize(n, std::vector<int>(n, 0));
+        adjList.resize(n);
+        rowWords = (n + 63) / 64;
+        inBits.assign((size_t)n * rowWords, 0);
+        weakComponents = UnionFind(n);
     }
 
     Graph::~Graph() {}
 
-    void Graph::addEdge(int u, int v, int weight) {
+    void Graph::addEdge(int u, int v, int weight, int cost) {
         // Validate vertices
         if (u < 0 || u >= n || v < 0 || v >= n) {
             std::cerr << "Error: Invalid vertex. Vertices must be between 0 and " 
@@ -37,9 +40,24 @@ namespace Graph {
             return;
         }
         
+        // A weight of 0 means "no edge" in the matrix - keep the lists consistent with it
+        if (weight == 0) return;
+
         // Add edge with weight
         adjMatrix[u][v] = weight;
-        if (!directed) adjMatrix[v][u] = weight;
+        if (cost != 0) {
+            if (costMatrix.empty()) costMatrix.resize(n, std::vector<int>(n, 0));
+            costMatrix[u][v] = cost;
+            if (!directed) costMatrix[v][u] = cost;
+        }
+        adjList[u].push_back(v);
+        inBits[(size_t)v * rowWords + u / 64] |= 1ULL << (u % 64);
+        if (!directed) {
+            adjMatrix[v][u] = weight;
+            adjList[v].push_back(u);
+            inBits[(size_t)u * rowWords + v / 64] |= 1ULL << (v % 64);
+        }
+        weakComponents.unite(u, v);
     }
 
     bool Graph::hasEdge(int u,int v) const{
@@ -61,6 +79,21 @@ namespace Graph {
         return adjMatrix[u][v];
     }
 
+    int Graph::getEdgeCost(int u, int v) const {
+        if (costMatrix.empty() || u < 0 || u >= n || v < 0 || v >= n) {
+            return 0;
+        }
+        return costMatrix[u][v];
+    }
+
+    bool Graph::hasCosts() const {
+        return !costMatrix.empty();
+    }
+
+    const std::vector<int>& Graph::neighbors(int v) const {
+        return adjList[v];
+    }
+
     int Graph::numOfVertices() const {
         return n;
     }
@@ -75,7 +108,9 @@ namespace Graph {
             std::cout << "Vertex " << i << ": ";
             for (int j = 0; j < n; ++j) {
                 if (adjMatrix[i][j] != 0) {
-                    std::cout << "(" << j << ", weight: " << adjMatrix[i][j] << ") ";
+                    std::cout << "(" << j << ", weight: " << adjMatrix[i][j];
+                    if (hasCosts()) std::cout << ", cost: " << costMatrix[i][j];
+                    std::cout << ") ";
                 }
             }
             std::cout << std::endl;
@@ -84,90 +119,224 @@ namespace Graph {
 
     int Graph::getVertexDegree(int v) const {
         if (v < 0 || v >= n) return 0;
-        int degree = 0;
-        for (int j = 0; j < n; ++j) {
-            if (adjMatrix[v][j] != 0) degree++;
-        }
-        return degree;
+        return (int)adjList[v].size();
+    }
+
+    const UnionFind& Graph::components() const {
+        return weakComponents;
     }
 
     bool Graph::Connected() const {
-        std::vector<bool> visited(n, false);
-        int start = -1;
-        for (int i = 0; i < n; ++i) {
-            for (int j = 0; j < n; ++j) {
-                if (adjMatrix[i][j] != 0) {
-                    start = i;
-                    break;
-                }
-            }
-            if (start != -1) break;
-        }
-        if (start == -1 && n != 1) return false;
-        if (start == -1 && n == 1) return true;
-        std::queue<int> q;
-        q.push(start);
-        visited[start] = true;
-        while (!q.empty()) {
-            int u = q.front(); q.pop();
-            for (int v = 0; v < n; ++v) {
-                if (adjMatrix[u][v] != 0 && !visited[v]) {
-                    visited[v] = true;
-                    q.push(v);
-                }
+        if (!directed) {
+            // Undirected: the vertices with edges must form a single component
+            int isolated = 0;
+            for (int i = 0; i < n; ++i) {
+                if (adjList[i].empty()) ++isolated;
             }
+            if (isolated == n) return n == 1;
+            return weakComponents.count() - isolated == 1;
+        }
+        int start = -1;
+        for (int i = 0; i < n && start == -1; ++i) {
+            if (!adjList[i].empty()) start = i;
         }
+        if (start == -1) return n == 1;
+        // Directed: every vertex with an out-edge must be reached from the first one
+        std::vector<int> dist = hopDistances(start);
         for (int i = 0; i < n; ++i) {
-            bool hasEdge = false;
-            for (int j = 0; j < n; ++j) {
-                if (adjMatrix[i][j] != 0) { hasEdge = true; break; }
-            }
-            if (hasEdge && !visited[i]) return false;
+            if (!adjList[i].empty() && dist[i] == -1) return false;
         }
         return true;
     }
 
-    std::vector<int> Graph::isEulerianCircuit() const {
-        std::vector<int> eulerianCircuit;
-        if (!Connected()) {
-            std::cout << "No Eulerian Circuit! The graph is not connected." << std::endl;
-            return eulerianCircuit;
+    std::vector<int> Graph::hopDistances(int source) const {
+        typedef unsigned long long Word;
+        const int W = 64;
+        const int words = rowWords;
+        std::vector<int> dist(n, -1);
+        if (source < 0 || source >= n) return dist;
+
+        long long edges = 0;
+        for (int v = 0; v < n; ++v) edges += adjList[v].size();
+
+        // On dense graphs (average degree of n/64 or more) a bottom-up test is n/64 word ANDs
+        // against the in-neighbor bit rows, cheaper than walking a long parent list
+        bool dense = edges * W >= (long long)n * n;
+
+        // In-degrees drive the switching heuristic; undirected graphs read them off adjList
+        std::vector<int> inDegree;
+        if (directed) {
+            inDegree.assign(n, 0);
+            for (int u = 0; u < n; ++u)
+                for (size_t i = 0; i < adjList[u].size(); ++i) ++inDegree[adjList[u][i]];
+        }
+        auto indegree = [&](int v) { return directed ? inDegree[v] : (int)adjList[v].size(); };
+
+        // In-neighbor lists (CSR) for sparse bottom-up steps on directed graphs
+        std::vector<int> inOffset, inTarget;
+        if (directed && !dense) {
+            inOffset.assign(n + 1, 0);
+            for (int v = 0; v < n; ++v) inOffset[v + 1] = inOffset[v] + inDegree[v];
+            inTarget.resize(edges);
+            std::vector<int> pos(inOffset.begin(), inOffset.end() - 1);
+            for (int u = 0; u < n; ++u)
+                for (size_t i = 0; i < adjList[u].size(); ++i) inTarget[pos[adjList[u][i]]++] = u;
         }
-        for (int v = 0; v < numOfVertices(); v++) {
-            if (getVertexDegree(v) % 2 != 0) {
-                std::cout << "No Eulerian Circuit! Vertex " << v << " has an odd degree." << std::endl;
-                return eulerianCircuit;
+
+        // Beamer et al. switching thresholds
+        const long long alpha = 14, beta = 24;
+        std::vector<int> frontier(1, source), next;
+        std::vector<Word> frontierBits(words, 0);
+        dist[source] = 0;
+        long long unexploredEdges = edges - (long long)indegree(source);
+        bool bottomUp = false;
+
+        for (int level = 0; !frontier.empty(); ++level) {
+            long long frontierEdges = 0;
+            for (size_t i = 0; i < frontier.size(); ++i) frontierEdges += adjList[frontier[i]].size();
+            if (!bottomUp && frontierEdges * alpha > unexploredEdges) bottomUp = true;
+            else if (bottomUp && (long long)frontier.size() * beta < n) bottomUp = false;
+
+            next.clear();
+            if (!bottomUp) {
+                for (size_t i = 0; i < frontier.size(); ++i) {
+                    const std::vector<int>& adj = adjList[frontier[i]];
+                    for (size_t k = 0; k < adj.size(); ++k) {
+                        if (dist[adj[k]] == -1) {
+                            dist[adj[k]] = level + 1;
+                            next.push_back(adj[k]);
+                        }
+                    }
+                }
+            } else {
+                std::fill(frontierBits.begin(), frontierBits.end(), 0);
+                for (size_t i = 0; i < frontier.size(); ++i)
+                    frontierBits[frontier[i] / W] |= 1ULL << (frontier[i] % W);
+                for (int v = 0; v < n; ++v) {
+                    if (dist[v] != -1) continue;
+                    bool found = false;
+                    if (dense) {
+                        const Word* row = &inBits[(size_t)v * words];
+                        for (int k = 0; k < words && !found; ++k) found = (row[k] & frontierBits[k]) != 0;
+                    } else if (directed) {
+                        for (int e = inOffset[v]; e < inOffset[v + 1] && !found; ++e)
+                            found = dist[inTarget[e]] == level;
+                    } else {
+                        const std::vector<int>& adj = adjList[v];
+                        for (size_t k = 0; k < adj.size() && !found; ++k) found = dist[adj[k]] == level;
+                    }
+                    if (found) next.push_back(v);
+                }
+                // Mark after the sweep so a vertex found this level cannot act as a parent
+                for (size_t i = 0; i < next.size(); ++i) dist[next[i]] = level + 1;
             }
+            for (size_t i = 0; i < next.size(); ++i) unexploredEdges -= indegree(next[i]);
+            frontier.swap(next);
         }
-        std::vector<std::vector<int>> graphCopy = adjMatrix;
-        std::stack<int> stack;
-        int start = 0;
-        for (int i = 0; i < numOfVertices(); ++i) {
-            for (int j = 0; j < numOfVertices(); ++j) {
-                if (graphCopy[i][j] != 0) { start = i; break; }
+        return dist;
+    }
+
+    int Graph::eulerianStart(bool circuit) const {
+        const char* what = circuit ? "Circuit" : "Path";
+        std::vector<int> in(n, 0);
+        if (directed) {
+            for (int u = 0; u < n; ++u)
+                for (size_t i = 0; i < adjList[u].size(); ++i) ++in[adjList[u][i]];
+        }
+
+        int first = -1, start = -1, end = -1;
+        for (int v = 0; v < n; ++v) {
+            int out = (int)adjList[v].size();
+            if (first == -1 && (out != 0 || in[v] != 0)) first = v;
+            if (directed) {
+                // Balanced vertices only; a path may have one extra exit (start) and one extra entry (end)
+                int diff = out - in[v];
+                if (diff == 0) continue;
+                if (!circuit && diff == 1 && start == -1) { start = v; continue; }
+                if (!circuit && diff == -1 && end == -1) { end = v; continue; }
+                std::cout << "No Eulerian " << what << "! Vertex " << v << " has in-degree " << in[v]
+                          << " and out-degree " << out << "." << std::endl;
+                return -1;
             }
-            if (start != 0) break;
+            // Even degrees only; a path may have its two ends odd
+            if (out % 2 == 0) continue;
+            if (!circuit && start == -1) { start = v; continue; }
+            if (!circuit && end == -1) { end = v; continue; }
+            std::cout << "No Eulerian " << what << "! Vertex " << v << " has an odd degree." << std::endl;
+            return -1;
         }
-        stack.push(start);
-        while (!stack.empty()) {
-            int u = stack.top();
-            bool found = false;
-            for (int v = 0; v < numOfVertices(); ++v) {
-                if (graphCopy[u][v] != 0) {
-                    graphCopy[u][v] = 0;
-                    if (!isDirected()) graphCopy[v][u] = 0;
-                    stack.push(v);
-                    found = true;
-                    break;
+
+        if (first == -1) {
+            // No edges at all: only a single vertex counts as connected
+            if (n == 1) return 0;
+            std::cout << "No Eulerian " << what << "! The graph is not connected." << std::endl;
+            return -1;
+        }
+        return start != -1 ? start : first;
+    }
+
+    std::vector<int> Graph::eulerianWalk(int start) const {
+        // Incidence lists (neighbor, edge id); both directions of an undirected edge share its id
+        std::vector<std::vector<std::pair<int, int>>> incident(n);
+        int edges = 0;
+        for (int u = 0; u < n; ++u) {
+            for (size_t i = 0; i < adjList[u].size(); ++i) {
+                int v = adjList[u][i];
+                if (directed) {
+                    incident[u].push_back(std::make_pair(v, edges++));
+                } else if (u < v) {
+                    incident[u].push_back(std::make_pair(v, edges));
+                    incident[v].push_back(std::make_pair(u, edges));
+                    ++edges;
                 }
             }
-            if (!found) {
-                eulerianCircuit.push_back(u);
-                stack.pop();
+        }
+
+        // Each vertex keeps a cursor into its list, so every edge is looked at O(1) times
+        std::vector<bool> used(edges, false);
+        std::vector<size_t> cursor(n, 0);
+        std::vector<int> walk;
+        std::vector<int> stack(1, start);
+        walk.reserve(edges + 1);
+        while (!stack.empty()) {
+            int u = stack.back();
+            while (cursor[u] < incident[u].size() && used[incident[u][cursor[u]].second]) ++cursor[u];
+            if (cursor[u] == incident[u].size()) {
+                walk.push_back(u);
+                stack.pop_back();
+            } else {
+                const std::pair<int, int>& e = incident[u][cursor[u]++];
+                used[e.second] = true;
+                stack.push_back(e.first);
             }
         }
-        std::reverse(eulerianCircuit.begin(), eulerianCircuit.end());
+        std::reverse(walk.begin(), walk.end());
+
+        // With the degree conditions met, missing edges can only mean another component
+        if ((int)walk.size() != edges + 1) walk.clear();
+        return walk;
+    }
+
+    std::vector<int> Graph::isEulerianCircuit() const {
+        std::vector<int> eulerianCircuit;
+        int start = eulerianStart(true);
+        if (start == -1) return eulerianCircuit;
+        eulerianCircuit = eulerianWalk(start);
+        if (eulerianCircuit.empty()) {
+            std::cout << "No Eulerian Circuit! The graph is not connected." << std::endl;
+        }
         return eulerianCircuit;
     }
 
+    std::vector<int> Graph::eulerianPath() const {
+        std::vector<int> path;
+        int start = eulerianStart(false);
+        if (start == -1) return path;
+        path = eulerianWalk(start);
+        if (path.empty()) {
+            std::cout << "No Eulerian Path! The graph is not connected." << std::endl;
+        }
+        return path;
+    }
+
 }
@@ -1,6 +1,7 @@
 #ifndef GRAPH_HPP
 #define GRAPH_HPP
 
+#include "UnionFind.hpp"
 #include <vector>
 
 namespace Graph {
@@ -10,6 +11,7 @@ namespace Graph {
      * @details This class implements a graph data structure where vertices are numbered from 0 to V-1
      *          and edges are stored with weights in an adjacency matrix. If the graph is undirected,
      *          the edge weight is mirrored across the diagonal. A weight of 0 indicates no edge.
+     *          Out-neighbor lists are kept next to the matrix so traversals can run in O(V+E).
      */
     class Graph{
         private:
@@ -17,6 +19,25 @@ namespace Graph {
             bool directed; ///< Flag indicating if the graph is directed
             
             std::vector<std::vector<int>> adjMatrix; ///< Adjacency matrix representation - stores weights of edges
+            std::vector<std::vector<int>> costMatrix; ///< Per-edge costs, allocated by the first edge that has one
+            std::vector<std::vector<int>> adjList; ///< Out-neighbors of each vertex, in insertion order
+            int rowWords; ///< 64-bit words per bitset row
+            std::vector<unsigned long long> inBits; ///< Bitset rows of in-neighbors (the matrix columns, bit-packed)
+            UnionFind weakComponents; ///< Connected components (ignoring direction), merged in addEdge
+
+            /**
+             * @brief Check the degree conditions for an Eulerian circuit or path and pick its start
+             * @param circuit true for a circuit, false for a path
+             * @return int start vertex, or -1 (after printing the reason) if the degrees rule it out
+             */
+            int eulerianStart(bool circuit) const;
+
+            /**
+             * @brief Hierholzer's algorithm over the neighbor lists, O(V+E)
+             * @param start vertex the walk starts from
+             * @return vector<int> walk using every edge once, empty if some edge is unreachable
+             */
+            std::vector<int> eulerianWalk(int start) const;
 
         public:
             /**
@@ -27,12 +48,13 @@ namespace Graph {
             Graph(int numVertices, bool isDirected = false);
 
             /**
-             * @brief Add an edge between two vertices with an optional weight
+             * @brief Add an edge between two vertices with an optional weight and cost
              * @param u first vertex (source)
              * @param v second vertex (destination)
              * @param weight weight of the edge (default is 1)
+             * @param cost cost per unit of flow on the edge (default is 0)
              */
-            void addEdge(int u, int v, int weight = 1);
+            void addEdge(int u, int v, int weight = 1, int cost = 0);
 
             /**
              * @brief Get the weight of the edge between two vertices
@@ -42,6 +64,20 @@ namespace Graph {
              */
             int getEdgeWeight(int u, int v) const;
 
+            /**
+             * @brief Get the cost of the edge between two vertices
+             * @param u first vertex
+             * @param v second vertex
+             * @return int cost of the edge, or 0 if no edge exists or it was added without a cost
+             */
+            int getEdgeCost(int u, int v) const;
+
+            /**
+             * @brief Check if any edge was added with a non-zero cost
+             * @return true if the graph carries costs
+             */
+            bool hasCosts() const;
+
             /**
              * @brief Get the number of vertices in the graph
              * @return int number of vertices
@@ -62,6 +98,13 @@ namespace Graph {
              */
             bool hasEdge(int u, int v) const;
 
+            /**
+             * @brief Get the out-neighbors of a vertex (both directions for undirected graphs)
+             * @param v vertex index (must be valid)
+             * @return const std::vector<int>& neighbors in edge insertion order
+             */
+            const std::vector<int>& neighbors(int v) const;
+
             /**
              * @brief Print the adjacency matrix and all edges with weights
              */
@@ -74,18 +117,43 @@ namespace Graph {
              */
             int getVertexDegree(int v) const;
 
+            /**
+             * @brief Connected components, ignoring edge direction
+             * @details Maintained online by addEdge, so they are ready once the last edge is added.
+             * @return const UnionFind& the component structure
+             */
+            const UnionFind& components() const;
+
             /**
              * @brief Check if the graph is connected
              * @return true if connected, false otherwise
              */
             bool Connected() const;
 
+            /**
+             * @brief Hop distances from a source by direction-optimizing BFS
+             * @details Levels are expanded top-down (frontier -> out-neighbors) while the frontier is
+             *          small and bottom-up (unvisited vertex -> any parent in the frontier) once its
+             *          edges outweigh those of the unvisited part. Bottom-up steps test parents with
+             *          word-wide ANDs of bitset rows on dense graphs and scan in-neighbor lists on
+             *          sparse ones.
+             * @param source start vertex
+             * @return vector<int> number of edges on a shortest path from source, -1 if unreachable
+             */
+            std::vector<int> hopDistances(int source) const;
+
             /**
              * @brief Find an Eulerian circuit if it exists
              * @return vector<int> containing the circuit, empty if none exists
              */
             std::vector<int> isEulerianCircuit() const;
 
+            /**
+             * @brief Find an Eulerian path (a circuit also counts) if it exists
+             * @return vector<int> containing the path, empty if none exists
+             */
+            std::vector<int> eulerianPath() const;
+
             /**
              * @brief Graph destructor - cleans up allocated memory
              */
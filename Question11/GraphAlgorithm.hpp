@@ -2,12 +2,39 @@
 #define GRAPH_ALGORITHM_HPP
 
 #include "Graph.hpp"
+#include "AlgorithmParams.hpp"
+#include <algorithm>
 #include <string>
+#include <vector>
 
 class GraphAlgorithm {
 public:
     virtual ~GraphAlgorithm() {}
     virtual std::string run(const Graph::Graph& graph) = 0;
+    // Run with the options sent in the request; algorithms without options ignore them.
+    virtual std::string run(const Graph::Graph& graph, const AlgorithmParams& params) {
+        (void)params;
+        return run(graph);
+    }
+
+protected:
+    /**
+     * @brief The vertices with the highest scores, best first (ties go to the smaller vertex)
+     * @param score one score per vertex
+     * @param k how many to return, clamped to [0, number of vertices]
+     * @return std::vector<int> the selected vertices
+     */
+    static std::vector<int> topVertices(const std::vector<double>& score, int k) {
+        int n = (int)score.size();
+        k = std::max(0, std::min(n, k));
+        std::vector<int> order(n);
+        for (int v = 0; v < n; ++v) order[v] = v;
+        std::partial_sort(order.begin(), order.begin() + k, order.end(), [&](int a, int b) {
+            return score[a] != score[b] ? score[a] > score[b] : a < b;
+        });
+        order.resize(k);
+        return order;
+    }
 };
 
 #endif // GRAPH_ALGORITHM_HPP
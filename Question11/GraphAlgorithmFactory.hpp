@@ -3,8 +3,28 @@
 
 #include "MSTAlgorithm.hpp"
 #include "MaxFlowAlgorithm.hpp"
+#include "PushRelabelAlgorithm.hpp"
+#include "BatchMaxFlowAlgorithm.hpp"
 #include "SCCAlgorithm.hpp"
+#include "ParallelSCCAlgorithm.hpp"
 #include "CliqueCountAlgorithm.hpp"
+#include "KCliqueAlgorithm.hpp"
+#include "MaxCliqueAlgorithm.hpp"
+#include "BFSAlgorithm.hpp"
+#include "ComponentsAlgorithm.hpp"
+#include "SSSPAlgorithm.hpp"
+#include "APSPAlgorithm.hpp"
+#include "ClosureAlgorithm.hpp"
+#include "PageRankAlgorithm.hpp"
+#include "TriangleAlgorithm.hpp"
+#include "BetweennessAlgorithm.hpp"
+#include "MatchingAlgorithm.hpp"
+#include "BridgesAlgorithm.hpp"
+#include "KCoreAlgorithm.hpp"
+#include "TopoSortAlgorithm.hpp"
+#include "CommunityAlgorithm.hpp"
+#include "MinCostFlowAlgorithm.hpp"
+#include "MinCutAlgorithm.hpp"
 #include "GraphAlgorithm.hpp"
 #include <string>
 
@@ -15,8 +35,29 @@ public:
     static GraphAlgorithm* create(const std::string& name) {
         if (name == "mst") return new MSTAlgorithm();
         if (name == "maxflow") return new MaxFlowAlgorithm();
+        if (name == "pushrelabel") return new PushRelabelAlgorithm(false);
+        if (name == "pushrelabel_parallel") return new PushRelabelAlgorithm(true);
+        if (name == "maxflow_batch") return new BatchMaxFlowAlgorithm();
         if (name == "scc") return new SCCAlgorithm();
+        if (name == "scc_parallel") return new ParallelSCCAlgorithm();
         if (name == "clique") return new CliqueCountAlgorithm();
+        if (name == "kclique") return new KCliqueAlgorithm();
+        if (name == "maxclique") return new MaxCliqueAlgorithm();
+        if (name == "bfs") return new BFSAlgorithm();
+        if (name == "components") return new ComponentsAlgorithm();
+        if (name == "sssp") return new SSSPAlgorithm();
+        if (name == "apsp") return new APSPAlgorithm();
+        if (name == "closure") return new ClosureAlgorithm();
+        if (name == "pagerank") return new PageRankAlgorithm();
+        if (name == "triangles") return new TriangleAlgorithm();
+        if (name == "betweenness") return new BetweennessAlgorithm();
+        if (name == "matching") return new MatchingAlgorithm();
+        if (name == "bridges") return new BridgesAlgorithm();
+        if (name == "kcore") return new KCoreAlgorithm();
+        if (name == "toposort") return new TopoSortAlgorithm();
+        if (name == "communities") return new CommunityAlgorithm();
+        if (name == "mincostflow") return new MinCostFlowAlgorithm();
+        if (name == "mincut") return new MinCutAlgorithm();
         // more algorithms here :D
         return nullptr;
     }
@@ -0,0 +1,126 @@
+#include "KCliqueAlgorithm.hpp"
+#include "BitGraph.hpp"
+#include "KCoreAlgorithm.hpp"
+#include "ThreadPool.hpp"
+#include <algorithm>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace {
+
+typedef unsigned long long Word;
+const int WORD_BITS = 64;
+
+// Cliques inside one root's candidate set. Local vertex j stands for cand[j]; row j holds
+// its neighbors among cand[j+1..], so growing a clique only ever looks forward.
+struct LocalCounter {
+    int words;
+    int maxSize;
+    std::vector<Word> rows;                 // c rows of 'words' words
+    std::vector<std::vector<Word>> scratch; // candidate set per depth
+    std::vector<long long>& counts;
+
+    LocalCounter(int maxSize, std::vector<long long>& counts)
+        : words(0), maxSize(maxSize), scratch(maxSize + 1), counts(counts) {}
+
+    // P = candidates that extend every vertex of a clique of 'size' vertices.
+    void grow(const Word* P, int size) {
+        if (size + 1 == maxSize) {
+            // Leaf level: every candidate closes one clique, no need to enumerate them.
+            long long c = 0;
+            for (int k = 0; k < words; ++k) c += __builtin_popcountll(P[k]);
+            counts[maxSize] += c;
+            return;
+        }
+        Word* Q = &scratch[size + 1][0];
+        for (int w = 0; w < words; ++w) {
+            Word bitsLeft = P[w];
+            while (bitsLeft) {
+                int u = w * WORD_BITS + __builtin_ctzll(bitsLeft);
+                bitsLeft &= bitsLeft - 1;
+                ++counts[size + 1];
+                const Word* row = &rows[(size_t)u * words];
+                bool any = false;
+                for (int k = 0; k < words; ++k) {
+                    Q[k] = P[k] & row[k];
+                    any |= Q[k] != 0;
+                }
+                if (any) grow(Q, size + 1);
+            }
+        }
+    }
+};
+
+}
+
+std::vector<long long> KCliqueAlgorithm::countCliques(const Graph::Graph& graph, int maxSize, int minSize) {
+    int n = graph.numOfVertices();
+    std::vector<long long> total(std::max(maxSize, 1) + 1, 0);
+    if (maxSize < 1) return total;
+    if (minSize <= 1) total[1] = n;
+    if (maxSize == 1) return total;
+
+    // Only the (minSize-1)-core can hold cliques of minSize vertices; the other vertices are
+    // neither roots nor candidates.
+    std::vector<int> core, order;
+    KCoreAlgorithm::coreNumbers(graph, core, &order);
+    int minCore = std::max(minSize, 1) - 1;
+    std::vector<int> position(n);
+    for (int i = 0; i < n; ++i) position[order[i]] = i;
+    std::vector<std::vector<int>> adj = BitGraph::undirectedNeighbors(graph);
+    // Same adjacency rule as BitGraph: u < v are adjacent when hasEdge(u, v).
+    auto adjacent = [&](int a, int b) { return a < b ? graph.hasEdge(a, b) : graph.hasEdge(b, a); };
+
+    std::mutex m;
+    ThreadPool::shared().parallelFor(0, n, [&](int lo, int hi) {
+        std::vector<long long> counts(maxSize + 1, 0);
+        LocalCounter counter(maxSize, counts);
+        std::vector<int> cand;
+        for (int i = lo; i < hi; ++i) {
+            int root = order[i];
+            if (core[root] < minCore) continue;
+            cand.clear();
+            for (size_t k = 0; k < adj[root].size(); ++k)
+                if (position[adj[root][k]] > i && core[adj[root][k]] >= minCore) cand.push_back(adj[root][k]);
+            if (cand.empty() || (int)cand.size() < minCore) continue;
+            std::sort(cand.begin(), cand.end(), [&](int a, int b) { return position[a] < position[b]; });
+
+            int c = (int)cand.size();
+            counter.words = (c + WORD_BITS - 1) / WORD_BITS;
+            counter.rows.assign((size_t)c * counter.words, 0);
+            for (int d = 0; d <= maxSize; ++d) counter.scratch[d].assign(counter.words, 0);
+            for (int j = 0; j < c; ++j)
+                for (int l = j + 1; l < c; ++l)
+                    if (adjacent(cand[j], cand[l]))
+                        counter.rows[(size_t)j * counter.words + l / WORD_BITS] |= 1ULL << (l % WORD_BITS);
+
+            // The root with all of its later neighbors as candidates: a clique of size 1.
+            Word* P = &counter.scratch[1][0];
+            for (int l = 0; l < c; ++l) P[l / WORD_BITS] |= 1ULL << (l % WORD_BITS);
+            counter.grow(P, 1);
+        }
+        std::lock_guard<std::mutex> lk(m);
+        for (int k = std::max(minSize, 2); k <= maxSize; ++k) total[k] += counts[k];
+    }, 16);
+    return total;
+}
+
+std::string KCliqueAlgorithm::run(const Graph::Graph& graph) {
+    return run(graph, AlgorithmParams());
+}
+
+std::string KCliqueAlgorithm::run(const Graph::Graph& graph, const AlgorithmParams& params) {
+    int minSize = params.getInt("min", 2), maxSize = params.getInt("max", 5);
+    if (minSize < 1 || maxSize < minSize)
+        return "Invalid clique sizes: need 1 <= min <= max";
+    std::vector<long long> counts = countCliques(graph, maxSize, minSize);
+    long long sum = 0;
+    std::string lines;
+    for (int k = minSize; k <= maxSize; ++k) {
+        sum += counts[k];
+        lines += "\n       k=" + std::to_string(k) + ": " + std::to_string(counts[k]);
+    }
+    return "Number of cliques (size " + std::to_string(minSize) + "-" + std::to_string(maxSize) + "): " +
+           std::to_string(sum) + lines;
+}
@@ -0,0 +1,26 @@
+#ifndef K_CLIQUE_ALGORITHM_HPP
+#define K_CLIQUE_ALGORITHM_HPP
+
+#include "GraphAlgorithm.hpp"
+#include <vector>
+
+/**
+ * @brief Parallel k-clique counting in the style of kClist
+ * @details Edges are oriented along the degeneracy order, so every vertex has at most
+ *          'degeneracy' later neighbors. Each root gets a local bitset graph over just those
+ *          neighbors and counts its cliques by recursive row intersections. Roots are handed
+ *          out to the shared ThreadPool in small dynamically claimed chunks. Vertices whose
+ *          core number is too small for the smallest requested size are skipped entirely.
+ */
+class KCliqueAlgorithm : public GraphAlgorithm {
+public:
+    std::string run(const Graph::Graph& graph) override;
+    // Options: min=<k> max=<k> clique sizes to report (default 2-5)
+    std::string run(const Graph::Graph& graph, const AlgorithmParams& params) override;
+
+    // counts[k] = number of cliques with k vertices, for k = minSize..maxSize (smaller sizes are
+    // left 0: vertices outside the (minSize-1)-core are skipped).
+    static std::vector<long long> countCliques(const Graph::Graph& graph, int maxSize, int minSize = 1);
+};
+
+#endif // K_CLIQUE_ALGORITHM_HPP
@@ -0,0 +1,151 @@
+#include "KCoreAlgorithm.hpp"
+#include "BitGraph.hpp"
+#include "ThreadPool.hpp"
+#include <algorithm>
+#include <atomic>
+#include <climits>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <vector>
+
+int KCoreAlgorithm::coreNumbers(const Graph::Graph& graph, std::vector<int>& core, std::vector<int>* order) {
+    int n = graph.numOfVertices();
+    std::vector<std::vector<int>> adj = BitGraph::undirectedNeighbors(graph);
+
+    // Vertices sorted by current degree (bucket sort); bucketStart[d] = first slot of degree d.
+    std::vector<int> degree(n), sorted(n), slot(n);
+    int maxDegree = 0;
+    for (int v = 0; v < n; ++v) {
+        degree[v] = (int)adj[v].size();
+        maxDegree = std::max(maxDegree, degree[v]);
+    }
+    std::vector<int> bucketStart(maxDegree + 2, 0);
+    for (int v = 0; v < n; ++v) ++bucketStart[degree[v] + 1];
+    for (int d = 0; d <= maxDegree; ++d) bucketStart[d + 1] += bucketStart[d];
+    std::vector<int> fill(bucketStart.begin(), bucketStart.end() - 1);
+    for (int v = 0; v < n; ++v) {
+        slot[v] = fill[degree[v]]++;
+        sorted[slot[v]] = v;
+    }
+
+    // Peel the minimum-degree vertex; a neighbor losing a degree swaps to the front of its bucket.
+    // The degree a vertex has when it is peeled is its core number.
+    int best = 0;
+    for (int i = 0; i < n; ++i) {
+        int v = sorted[i];
+        best = std::max(best, degree[v]);
+        for (size_t k = 0; k < adj[v].size(); ++k) {
+            int u = adj[v][k];
+            if (degree[u] <= degree[v]) continue; // already peeled or in the same bucket
+            int du = degree[u];
+            int firstSlot = bucketStart[du];
+            int w = sorted[firstSlot];
+            if (w != u) {
+                std::swap(sorted[slot[u]], sorted[firstSlot]);
+                slot[w] = slot[u];
+                slot[u] = firstSlot;
+            }
+            ++bucketStart[du];
+            --degree[u];
+        }
+    }
+    core.swap(degree);
+    if (order) order->swap(sorted);
+    return best;
+}
+
+int KCoreAlgorithm::parallelCoreNumbers(const Graph::Graph& graph, std::vector<int>& core) {
+    int n = graph.numOfVertices();
+    std::vector<std::vector<int>> adj = BitGraph::undirectedNeighbors(graph);
+    ThreadPool& pool = ThreadPool::shared();
+    std::mutex m;
+
+    std::vector<std::atomic<int>> degree(n);
+    for (int v = 0; v < n; ++v) degree[v].store((int)adj[v].size());
+    core.assign(n, -1);
+
+    int removed = 0, best = 0;
+    std::vector<int> frontier, next;
+    while (removed < n) {
+        // Empty levels are skipped: k jumps straight to the smallest remaining degree.
+        int k = INT_MAX;
+        pool.parallelFor(0, n, [&](int lo, int hi) {
+            int local = INT_MAX;
+            for (int v = lo; v < hi; ++v)
+                if (core[v] < 0) local = std::min(local, degree[v].load(std::memory_order_relaxed));
+            std::lock_guard<std::mutex> lk(m);
+            k = std::min(k, local);
+        }, 1024);
+        best = k;
+
+        frontier.clear();
+        pool.parallelFor(0, n, [&](int lo, int hi) {
+            std::vector<int> local;
+            for (int v = lo; v < hi; ++v)
+                if (core[v] < 0 && degree[v].load(std::memory_order_relaxed) <= k) local.push_back(v);
+            std::lock_guard<std::mutex> lk(m);
+            frontier.insert(frontier.end(), local.begin(), local.end());
+        }, 1024);
+
+        // Sub-rounds at level k. Only the decrement that takes a neighbor from k + 1 to k
+        // queues it; one that would go below k is undone, so every vertex is queued once.
+        while (!frontier.empty()) {
+            for (size_t i = 0; i < frontier.size(); ++i) core[frontier[i]] = k;
+            removed += (int)frontier.size();
+            next.clear();
+            pool.parallelFor(0, (int)frontier.size(), [&](int lo, int hi) {
+                std::vector<int> local;
+                for (int i = lo; i < hi; ++i) {
+                    const std::vector<int>& nb = adj[frontier[i]];
+                    for (size_t j = 0; j < nb.size(); ++j) {
+                        int u = nb[j];
+                        if (core[u] >= 0) continue; // peeled in an earlier sub-round
+                        int old = degree[u].fetch_sub(1, std::memory_order_relaxed);
+                        if (old == k + 1) local.push_back(u);
+                        else if (old <= k) degree[u].fetch_add(1, std::memory_order_relaxed);
+                    }
+                }
+                std::lock_guard<std::mutex> lk(m);
+                next.insert(next.end(), local.begin(), local.end());
+            }, 64);
+            frontier.swap(next);
+        }
+    }
+    return best;
+}
+
+std::vector<int> KCoreAlgorithm::innerCore(const std::vector<int>& order, const std::vector<int>& core, int k) {
+    std::vector<int> kept;
+    for (size_t i = 0; i < order.size(); ++i)
+        if (core[order[i]] >= k) kept.push_back(order[i]);
+    return kept;
+}
+
+std::string KCoreAlgorithm::run(const Graph::Graph& graph) {
+    return run(graph, AlgorithmParams());
+}
+
+std::string KCoreAlgorithm::run(const Graph::Graph& graph, const AlgorithmParams& params) {
+    int n = graph.numOfVertices();
+    std::string mode = params.getString("mode", "bz");
+    std::vector<int> core;
+    int degeneracy;
+    if (mode == "bz") degeneracy = coreNumbers(graph, core);
+    else if (mode == "parallel") degeneracy = parallelCoreNumbers(graph, core);
+    else return "Unknown mode: " + mode + " (use bz or parallel)";
+
+    std::ostringstream out;
+    out << "Degeneracy: " << degeneracy << "\n       Core numbers:";
+    for (int v = 0; v < n; ++v) out << (v ? ", " : " ") << core[v];
+
+    int k = params.getInt("k", -1);
+    if (k >= 0) {
+        std::vector<int> members;
+        for (int v = 0; v < n; ++v)
+            if (core[v] >= k) members.push_back(v);
+        out << "\n       " << k << "-core: " << members.size() << " vertices";
+        for (size_t i = 0; i < members.size(); ++i) out << (i ? ", " : ": ") << members[i];
+    }
+    return out.str();
+}
@@ -0,0 +1,39 @@
+#ifndef K_CORE_ALGORITHM_HPP
+#define K_CORE_ALGORITHM_HPP
+
+#include "GraphAlgorithm.hpp"
+#include <vector>
+
+/**
+ * @brief Core numbers of every vertex (largest k such that the vertex is in the k-core)
+ * @details The sequential engine is Batagelj-Zaversnik bucket peeling in O(V+E), which also
+ *          yields the degeneracy order the clique engines build on. The parallel engine peels
+ *          level by level: all vertices of degree <= k leave together, neighbors dropping to k
+ *          join the next sub-round, and k only grows once nothing of degree <= k is left.
+ *          Adjacency is the BitGraph rule, so directed graphs are peeled as undirected ones.
+ */
+class KCoreAlgorithm : public GraphAlgorithm {
+public:
+    std::string run(const Graph::Graph& graph) override;
+    // Options: mode=bz|parallel (default bz), k=<k> also lists the vertices of the k-core
+    std::string run(const Graph::Graph& graph, const AlgorithmParams& params) override;
+
+    /**
+     * @brief Core numbers by bucket peeling
+     * @param graph source graph
+     * @param core filled with the core number of each vertex
+     * @param order if not null, receives the vertices in peeling order - each has at most
+     *        core[v] neighbors later in the order, and core numbers never decrease along it
+     * @return int the degeneracy (largest core number, 0 for an empty graph)
+     */
+    static int coreNumbers(const Graph::Graph& graph, std::vector<int>& core, std::vector<int>* order = nullptr);
+
+    // Same core numbers, peeled level-synchronously on the shared ThreadPool.
+    static int parallelCoreNumbers(const Graph::Graph& graph, std::vector<int>& core);
+
+    // The vertices of 'order' whose core number is at least k, in the same order. A clique of
+    // k + 1 vertices lies entirely inside them.
+    static std::vector<int> innerCore(const std::vector<int>& order, const std::vector<int>& core, int k);
+};
+
+#endif // K_CORE_ALGORITHM_HPP
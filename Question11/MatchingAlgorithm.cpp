@@ -0,0 +1,121 @@
+#include "MatchingAlgorithm.hpp"
+#include <string>
+#include <vector>
+
+int MatchingAlgorithm::maximumMatching(const Graph::Graph& graph, std::vector<int>& mate) {
+    int n = graph.numOfVertices();
+    mate.assign(n, -1);
+
+    // Undirected neighbor lists: u ~ v when there is an edge either way.
+    std::vector<std::vector<int>> adj(n);
+    for (int u = 0; u < n; ++u) {
+        const std::vector<int>& out = graph.neighbors(u);
+        for (size_t i = 0; i < out.size(); ++i) {
+            int v = out[i];
+            adj[u].push_back(v);
+            if (graph.isDirected() && !graph.hasEdge(v, u)) adj[v].push_back(u);
+        }
+    }
+
+    // 2-coloring; the left side is color 0.
+    std::vector<int> color(n, -1), queue;
+    queue.reserve(n);
+    for (int s = 0; s < n; ++s) {
+        if (color[s] != -1) continue;
+        color[s] = 0;
+        queue.assign(1, s);
+        for (size_t head = 0; head < queue.size(); ++head) {
+            int u = queue[head];
+            for (size_t i = 0; i < adj[u].size(); ++i) {
+                int v = adj[u][i];
+                if (color[v] == -1) {
+                    color[v] = 1 - color[u];
+                    queue.push_back(v);
+                } else if (color[v] == color[u]) {
+                    return -1;
+                }
+            }
+        }
+    }
+
+    std::vector<int> left;
+    for (int v = 0; v < n; ++v)
+        if (color[v] == 0) left.push_back(v);
+
+    const int INF = n + 1;
+    std::vector<int> dist(n, INF);
+    std::vector<size_t> next(n);
+    std::vector<int> stack;
+    int size = 0;
+    for (;;) {
+        // Layers: free left vertices at 0, then alternate non-matching / matching edges.
+        queue.clear();
+        for (size_t i = 0; i < left.size(); ++i) {
+            int u = left[i];
+            dist[u] = mate[u] == -1 ? 0 : INF;
+            if (dist[u] == 0) queue.push_back(u);
+        }
+        // Stop at the first layer that sees a free right vertex: only shortest paths count.
+        int limit = INF;
+        for (size_t head = 0; head < queue.size(); ++head) {
+            int u = queue[head];
+            if (dist[u] >= limit) break;
+            for (size_t i = 0; i < adj[u].size(); ++i) {
+                int w = mate[adj[u][i]];
+                if (w == -1) limit = dist[u] + 1;
+                else if (dist[w] == INF) {
+                    dist[w] = dist[u] + 1;
+                    queue.push_back(w);
+                }
+            }
+        }
+        if (limit == INF) break;
+
+        // Disjoint shortest augmenting paths. stack holds the left vertices of the current
+        // path; next[u] is the edge of u being tried. Dead ends leave the layering for good.
+        for (size_t i = 0; i < left.size(); ++i) next[left[i]] = 0;
+        for (size_t i = 0; i < left.size(); ++i) {
+            int root = left[i];
+            if (mate[root] != -1) continue;
+            stack.assign(1, root);
+            while (!stack.empty()) {
+                int u = stack.back();
+                if (next[u] == adj[u].size()) {
+                    dist[u] = INF;
+                    stack.pop_back();
+                    if (!stack.empty()) ++next[stack.back()];
+                    continue;
+                }
+                int v = adj[u][next[u]];
+                int w = mate[v];
+                if (w == -1 && dist[u] + 1 == limit) {
+                    for (size_t k = 0; k < stack.size(); ++k) {
+                        int l = stack[k], r = adj[l][next[l]];
+                        mate[l] = r;
+                        mate[r] = l;
+                    }
+                    ++size;
+                    break;
+                }
+                if (w != -1 && dist[w] == dist[u] + 1) stack.push_back(w);
+                else ++next[u];
+            }
+        }
+    }
+    return size;
+}
+
+std::string MatchingAlgorithm::run(const Graph::Graph& graph) {
+    std::vector<int> mate;
+    int size = maximumMatching(graph, mate);
+    if (size < 0) return "Graph is not bipartite";
+    std::string result = "Maximum matching size: " + std::to_string(size) + "\n       Pairs:";
+    bool first = true;
+    for (int v = 0; v < graph.numOfVertices(); ++v) {
+        if (mate[v] == -1 || mate[v] < v) continue;
+        result += (first ? " " : ", ") + std::to_string(v) + "-" + std::to_string(mate[v]);
+        first = false;
+    }
+    if (first) result += " none";
+    return result;
+}
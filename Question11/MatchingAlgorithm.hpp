@@ -0,0 +1,28 @@
+#ifndef MATCHING_ALGORITHM_HPP
+#define MATCHING_ALGORITHM_HPP
+
+#include "GraphAlgorithm.hpp"
+#include <vector>
+
+/**
+ * @brief Maximum bipartite matching by Hopcroft-Karp, O(E sqrt(V))
+ * @details Edge direction is ignored. The sides come from a BFS 2-coloring (color 0 of each
+ *          component is the left side), which also rejects graphs with an odd cycle. Each
+ *          phase layers the graph by BFS from the free left vertices and then augments along
+ *          vertex-disjoint shortest paths with an explicit-stack DFS, so long augmenting
+ *          paths cannot overflow the call stack.
+ */
+class MatchingAlgorithm : public GraphAlgorithm {
+public:
+    std::string run(const Graph::Graph& graph) override;
+
+    /**
+     * @brief Compute a maximum matching
+     * @param graph source graph
+     * @param mate filled with the partner of each vertex, -1 if unmatched
+     * @return int matching size, or -1 if the graph is not bipartite
+     */
+    static int maximumMatching(const Graph::Graph& graph, std::vector<int>& mate);
+};
+
+#endif // MATCHING_ALGORITHM_HPP
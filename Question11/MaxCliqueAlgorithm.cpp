@@ -0,0 +1,140 @@
+#include "MaxCliqueAlgorithm.hpp"
+#include "KCoreAlgorithm.hpp"
+#include <algorithm>
+#include <chrono>
+#include <string>
+#include <vector>
+
+namespace {
+
+typedef BitGraph::Word Word;
+
+struct Search {
+    const BitGraph& bg;
+    int words;
+    std::vector<int> current, best;
+    size_t known; // size of a clique found before the search, which 'best' has to beat
+    std::chrono::steady_clock::time_point deadline;
+    bool limited;
+    bool timedOut;
+    long long nodes;
+
+    Search(const BitGraph& bg)
+        : bg(bg), words(bg.numOfWords()), known(0), limited(false), timedOut(false), nodes(0) {}
+
+    int bound() const { return (int)std::max(best.size(), known); }
+
+    bool outOfTime() {
+        // Reading the clock on every node would dominate small subproblems.
+        if (limited && !timedOut && (++nodes & 1023) == 0 && std::chrono::steady_clock::now() >= deadline)
+            timedOut = true;
+        return timedOut;
+    }
+
+    void expand(std::vector<Word>& P) {
+        if (outOfTime()) return;
+
+        // Greedy coloring: color classes are independent sets peeled off P in order.
+        // Only vertices whose color could still beat the best clique are branched on.
+        int minColor = bound() - (int)current.size() + 1;
+        std::vector<int> vertices, colors;
+        std::vector<Word> uncolored(P), Q(words);
+        int color = 1;
+        bool left = true;
+        while (left) {
+            Q = uncolored;
+            for (int k = 0; k < words; ++k) {
+                while (Q[k]) {
+                    int v = k * BitGraph::WORD_BITS + __builtin_ctzll(Q[k]);
+                    Word bit = 1ULL << (v % BitGraph::WORD_BITS);
+                    uncolored[k] &= ~bit;
+                    Q[k] &= ~bit;
+                    const Word* row = bg.row(v);
+                    for (int j = k; j < words; ++j) Q[j] &= ~row[j];
+                    if (color >= minColor) {
+                        vertices.push_back(v);
+                        colors.push_back(color);
+                    }
+                }
+            }
+            ++color;
+            left = false;
+            for (int k = 0; k < words && !left; ++k) left = uncolored[k] != 0;
+        }
+
+        std::vector<Word> nextP(words);
+        for (int i = (int)vertices.size() - 1; i >= 0; --i) {
+            if ((int)current.size() + colors[i] <= bound()) return;
+            if (timedOut) return;
+            int v = vertices[i];
+            const Word* row = bg.row(v);
+            bool any = false;
+            for (int k = 0; k < words; ++k) {
+                nextP[k] = P[k] & row[k];
+                any = any || nextP[k] != 0;
+            }
+            current.push_back(v);
+            if (!any) {
+                if ((int)current.size() > bound()) best = current;
+            } else {
+                expand(nextP);
+            }
+            current.pop_back();
+            P[v / BitGraph::WORD_BITS] &= ~(1ULL << (v % BitGraph::WORD_BITS));
+        }
+    }
+};
+
+}
+
+bool MaxCliqueAlgorithm::maximumClique(const BitGraph& bg, long long budgetMs, std::vector<int>& clique) {
+    Search search(bg);
+    search.known = clique.size();
+    if (budgetMs > 0) {
+        search.limited = true;
+        search.deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(budgetMs);
+    }
+    std::vector<Word> P(bg.numOfWords(), 0);
+    for (int i = 0; i < bg.size(); ++i) P[i / BitGraph::WORD_BITS] |= 1ULL << (i % BitGraph::WORD_BITS);
+    search.expand(P);
+
+    if (search.best.empty()) return !search.timedOut;
+    clique.clear();
+    for (size_t i = 0; i < search.best.size(); ++i) clique.push_back(bg.vertex(search.best[i]));
+    std::sort(clique.begin(), clique.end());
+    return !search.timedOut;
+}
+
+std::string MaxCliqueAlgorithm::run(const Graph::Graph& graph) {
+    return run(graph, AlgorithmParams());
+}
+
+std::string MaxCliqueAlgorithm::run(const Graph::Graph& graph, const AlgorithmParams& params) {
+    // Densest part first: the reverse degeneracy order puts the innermost core at position 0.
+    std::vector<int> core, order;
+    KCoreAlgorithm::coreNumbers(graph, core, &order);
+    std::reverse(order.begin(), order.end());
+
+    // Greedy clique along that order. A larger clique needs core numbers >= its size, so
+    // only that inner core is searched.
+    std::vector<int> clique;
+    for (size_t i = 0; i < order.size(); ++i) {
+        int v = order[i];
+        if (core[v] < (int)clique.size()) break;
+        bool all = true;
+        for (size_t j = 0; j < clique.size() && all; ++j)
+            all = clique[j] < v ? graph.hasEdge(clique[j], v) : graph.hasEdge(v, clique[j]);
+        if (all) clique.push_back(v);
+    }
+    BitGraph bg(graph, KCoreAlgorithm::innerCore(order, core, (int)clique.size()));
+    std::sort(clique.begin(), clique.end());
+    bool exact = maximumClique(bg, params.getInt("budget_ms", 0), clique);
+    std::string result = "Maximum clique size: " + std::to_string(clique.size());
+    if (!exact) result += " (time budget reached, best found so far)";
+    result += "\n       Vertices: ";
+    for (size_t i = 0; i < clique.size(); ++i) {
+        if (i) result += ", ";
+        result += std::to_string(clique[i]);
+    }
+    return result;
+}
@@ -0,0 +1,34 @@
+#ifndef MAX_CLIQUE_ALGORITHM_HPP
+#define MAX_CLIQUE_ALGORITHM_HPP
+
+#include "GraphAlgorithm.hpp"
+#include "BitGraph.hpp"
+#include <vector>
+
+/**
+ * @brief Maximum clique by bit-parallel branch and bound (BBMC style)
+ * @details Candidates are bitsets over BitGraph rows; at each node a greedy sequential
+ *          coloring of the candidates bounds the clique size reachable from it, and vertices
+ *          are branched on from the highest color down until the bound cannot beat the best.
+ *          A greedy clique along the degeneracy order gives the first bound, and only the
+ *          inner core that could hold a larger clique is searched. An optional time budget
+ *          stops the search and returns the best clique found so far.
+ */
+class MaxCliqueAlgorithm : public GraphAlgorithm {
+public:
+    std::string run(const Graph::Graph& graph) override;
+    // Options: budget_ms=<ms> stop after this much time (default 0 = no limit)
+    std::string run(const Graph::Graph& graph, const AlgorithmParams& params) override;
+
+    /**
+     * @brief Find a maximum clique
+     * @param bg bit rows of the graph
+     * @param budgetMs time budget in milliseconds (0 = exact search)
+     * @param clique a known clique the search has to beat (may be empty); replaced by a larger
+     *        one if found (graph vertices, ascending)
+     * @return true if the search finished (the clique is maximum), false if the budget ran out
+     */
+    static bool maximumClique(const BitGraph& bg, long long budgetMs, std::vector<int>& clique);
+};
+
+#endif // MAX_CLIQUE_ALGORITHM_HPP
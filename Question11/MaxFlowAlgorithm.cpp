@@ -5,12 +5,19 @@
 #include <string>
 
 std::string MaxFlowAlgorithm::run(const Graph::Graph& graph) {
+    return run(graph, AlgorithmParams());
+}
+
+std::string MaxFlowAlgorithm::run(const Graph::Graph& graph, const AlgorithmParams& params) {
     int n = graph.numOfVertices();
+    int s, t;
+    std::string error = readTerminals(graph, params, s, t);
+    if (!error.empty()) return error;
     std::vector<std::vector<int>> capacity(n, std::vector<int>(n, 0));
     for (int u = 0; u < n; ++u)
         for (int v = 0; v < n; ++v)
             capacity[u][v] = graph.getEdgeWeight(u, v);
-    int flow = 0;
+    long long flow = 0;
     std::vector<int> parent(n);
     auto bfs = [&](int s, int t) -> int {
         std::fill(parent.begin(), parent.end(), -1);
@@ -30,7 +37,6 @@ std::string MaxFlowAlgorithm::run(const Graph::Graph& graph) {
         }
         return 0;
     };
-    int s = 0, t = n - 1;
     int new_flow;
     do {
         new_flow = bfs(s, t);
@@ -45,5 +51,59 @@ std::string MaxFlowAlgorithm::run(const Graph::Graph& graph) {
             }
         }
     } while (new_flow);
-    return "Max flow from 0 to n-1: " + std::to_string(flow);
+
+    // Min cut: whatever can still reach t in the residual graph is on the sink side.
+    // One more backward BFS over the matrix, the same cost as an augmenting step.
+    std::vector<bool> sinkSide(n, false);
+    std::queue<int> q;
+    q.push(t);
+    sinkSide[t] = true;
+    while (!q.empty()) {
+        int v = q.front(); q.pop();
+        for (int u = 0; u < n; ++u) {
+            if (!sinkSide[u] && capacity[u][v] > 0) {
+                sinkSide[u] = true;
+                q.push(u);
+            }
+        }
+    }
+    return formatResult(graph, s, t, flow, sinkSide);
+}
+
+std::string MaxFlowAlgorithm::readTerminals(const Graph::Graph& graph, const AlgorithmParams& params, int& s, int& t) {
+    int n = graph.numOfVertices();
+    s = params.getInt("s", 0);
+    t = params.getInt("t", n - 1);
+    if (s < 0 || s >= n || t < 0 || t >= n)
+        return "Invalid source/sink: vertices must be between 0 and " + std::to_string(n - 1);
+    if (s == t && n > 1)
+        return "Invalid source/sink: source and sink must differ";
+    return "";
+}
+
+std::string MaxFlowAlgorithm::formatResult(const Graph::Graph& graph, int s, int t, long long flow,
+                                           const std::vector<bool>& sinkSide) {
+    int n = graph.numOfVertices();
+    std::string result = "Max flow from " + std::to_string(s) + " to " + std::to_string(t) + ": " + std::to_string(flow);
+    result += "\n       Min cut source side: ";
+    bool first = true;
+    for (int v = 0; v < n; ++v) {
+        if (sinkSide[v]) continue;
+        if (!first) result += ", ";
+        result += std::to_string(v);
+        first = false;
+    }
+    result += "\n       Cut edges:";
+    first = true;
+    for (int u = 0; u < n; ++u) {
+        if (sinkSide[u]) continue;
+        for (int v = 0; v < n; ++v) {
+            if (!sinkSide[v] || !graph.hasEdge(u, v)) continue;
+            result += first ? " " : ", ";
+            result += std::to_string(u) + "->" + std::to_string(v) + " (" + std::to_string(graph.getEdgeWeight(u, v)) + ")";
+            first = false;
+        }
+    }
+    if (first) result += " none";
+    return result;
 }
@@ -7,6 +7,16 @@
 class MaxFlowAlgorithm : public GraphAlgorithm {
 public:
     std::string run(const Graph::Graph& graph) override;
+    // Options: s=<source> t=<sink> (default 0 and n-1)
+    std::string run(const Graph::Graph& graph, const AlgorithmParams& params) override;
+
+    // Read the s/t options of a max-flow request; returns an error text, or "" if they are valid.
+    static std::string readTerminals(const Graph::Graph& graph, const AlgorithmParams& params, int& s, int& t);
+
+    // Result text shared by the max-flow strategies: the flow value, the source side of the
+    // min cut and the cut edges. sinkSide[v] is true if v can still reach t in the final residual graph.
+    static std::string formatResult(const Graph::Graph& graph, int s, int t, long long flow,
+                                    const std::vector<bool>& sinkSide);
 };
 
 #endif // MAX_FLOW_ALGORITHM_HPP
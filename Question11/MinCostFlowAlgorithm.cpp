@@ -0,0 +1,292 @@
+#include "MinCostFlowAlgorithm.hpp"
+#include "FlowNetwork.hpp"
+#include "MaxFlowAlgorithm.hpp"
+#include "PushRelabelAlgorithm.hpp"
+#include "RadixHeap.hpp"
+#include <algorithm>
+#include <climits>
+#include <cstdlib>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace {
+
+// One arc pair per graph edge, grouped by tail vertex (CSR). The reverse arc of an edge
+// starts with no capacity and the negated cost.
+struct CostNetwork {
+    struct Arc {
+        int to;
+        int rev;
+        long long cap;
+        long long cost;
+    };
+
+    int n;
+    std::vector<int> first;
+    std::vector<Arc> arcs;
+    std::vector<std::vector<int>> edgeArc; // forward arc of the edge to graph.neighbors(u)[i]
+    std::vector<long long> original;       // capacity of each arc before any flow
+
+    explicit CostNetwork(const Graph::Graph& graph) : n(graph.numOfVertices()), first(n + 1, 0), edgeArc(n) {
+        for (int u = 0; u < n; ++u) {
+            const std::vector<int>& adj = graph.neighbors(u);
+            first[u + 1] += (int)adj.size();
+            for (size_t i = 0; i < adj.size(); ++i) ++first[adj[i] + 1];
+        }
+        for (int v = 0; v < n; ++v) first[v + 1] += first[v];
+        arcs.resize(first[n]);
+        std::vector<int> pos(first.begin(), first.end() - 1);
+        for (int u = 0; u < n; ++u) {
+            const std::vector<int>& adj = graph.neighbors(u);
+            for (size_t i = 0; i < adj.size(); ++i) {
+                int v = adj[i];
+                int a = pos[u]++, b = pos[v]++;
+                long long c = graph.getEdgeCost(u, v);
+                arcs[a].to = v; arcs[a].rev = b; arcs[a].cap = graph.getEdgeWeight(u, v); arcs[a].cost = c;
+                arcs[b].to = u; arcs[b].rev = a; arcs[b].cap = 0; arcs[b].cost = -c;
+                edgeArc[u].push_back(a);
+            }
+        }
+        original.resize(arcs.size());
+        for (size_t a = 0; a < arcs.size(); ++a) original[a] = arcs[a].cap;
+    }
+
+    void push(int a, long long amount) {
+        arcs[a].cap -= amount;
+        arcs[arcs[a].rev].cap += amount;
+    }
+
+    void collect(long long& cost, std::vector<std::vector<long long>>& edgeFlow) const {
+        cost = 0;
+        edgeFlow.assign(n, std::vector<long long>());
+        for (int u = 0; u < n; ++u)
+            for (size_t i = 0; i < edgeArc[u].size(); ++i) {
+                int a = edgeArc[u][i];
+                long long f = original[a] - arcs[a].cap;
+                edgeFlow[u].push_back(f);
+                cost += f * arcs[a].cost;
+            }
+    }
+};
+
+// Potentials that make every residual reduced cost non-negative: distances from a virtual
+// source joined to every vertex, by Bellman-Ford with a work queue. Costs that are all
+// non-negative need none. Returns false on a negative cycle, which neither method can start from.
+bool initialPotentials(const CostNetwork& net, std::vector<long long>& potential) {
+    int n = net.n;
+    potential.assign(n, 0);
+    bool negative = false;
+    for (size_t a = 0; a < net.arcs.size() && !negative; ++a) negative = net.arcs[a].cap > 0 && net.arcs[a].cost < 0;
+    if (!negative) return true;
+
+    std::vector<int> queue, relaxed(n, 0);
+    std::vector<bool> queued(n, true);
+    for (int v = 0; v < n; ++v) queue.push_back(v);
+    for (size_t head = 0; head < queue.size(); ++head) {
+        int u = queue[head];
+        queued[u] = false;
+        for (int a = net.first[u]; a < net.first[u + 1]; ++a) {
+            const CostNetwork::Arc& arc = net.arcs[a];
+            if (arc.cap <= 0 || potential[u] + arc.cost >= potential[arc.to]) continue;
+            potential[arc.to] = potential[u] + arc.cost;
+            if (++relaxed[arc.to] > n) return false;
+            if (!queued[arc.to]) { queued[arc.to] = true; queue.push_back(arc.to); }
+        }
+    }
+    return true;
+}
+
+}
+
+bool MinCostFlowAlgorithm::successiveShortestPaths(const Graph::Graph& graph, int s, int t, long long limit,
+                                                   long long& flow, long long& cost,
+                                                   std::vector<std::vector<long long>>& edgeFlow) {
+    CostNetwork net(graph);
+    int n = net.n;
+    std::vector<long long> potential;
+    if (!initialPotentials(net, potential)) return false;
+
+    flow = 0;
+    if (s == t) limit = 0;
+    std::vector<long long> dist(n);
+    std::vector<int> predArc(n);
+    std::vector<char> done(n);
+    while (flow < limit) {
+        // Dijkstra on reduced costs, stopped once t is settled.
+        std::fill(dist.begin(), dist.end(), -1);
+        std::fill(done.begin(), done.end(), 0);
+        RadixHeap heap;
+        dist[s] = 0;
+        heap.push(0, s);
+        while (!heap.empty()) {
+            int u = heap.pop().second;
+            if (done[u]) continue;
+            done[u] = 1;
+            if (u == t) break;
+            for (int a = net.first[u]; a < net.first[u + 1]; ++a) {
+                const CostNetwork::Arc& arc = net.arcs[a];
+                if (arc.cap <= 0 || done[arc.to]) continue;
+                long long d = dist[u] + arc.cost + potential[u] - potential[arc.to];
+                if (dist[arc.to] == -1 || d < dist[arc.to]) {
+                    dist[arc.to] = d;
+                    predArc[arc.to] = a;
+                    heap.push(d, arc.to);
+                }
+            }
+        }
+        if (!done[t]) break;
+
+        // Settled vertices move by their distance, all others by dist[t]; either way every
+        // residual reduced cost stays non-negative.
+        for (int v = 0; v < n; ++v) potential[v] += done[v] ? dist[v] : dist[t];
+
+        long long amount = limit - flow;
+        for (int v = t; v != s; v = net.arcs[net.arcs[predArc[v]].rev].to)
+            amount = std::min(amount, net.arcs[predArc[v]].cap);
+        for (int v = t; v != s; v = net.arcs[net.arcs[predArc[v]].rev].to) net.push(predArc[v], amount);
+        flow += amount;
+    }
+    net.collect(cost, edgeFlow);
+    return true;
+}
+
+bool MinCostFlowAlgorithm::costScaling(const Graph::Graph& graph, int s, int t, long long limit, long long& flow,
+                                       long long& cost, std::vector<std::vector<long long>>& edgeFlow) {
+    CostNetwork net(graph);
+    int n = net.n;
+    std::vector<long long> potential;
+    if (!initialPotentials(net, potential)) return false;
+
+    FlowNetwork maxNet(graph);
+    flow = s == t ? 0 : std::min(limit, PushRelabelAlgorithm().maxFlow(maxNet, s, t));
+
+    // With costs scaled by n+1, a flow that is 1-optimal is optimal for the real costs.
+    // Starting from the (scaled) potentials of the cycle check, no arc has a negative reduced
+    // cost yet, so the first phase does not saturate every negative-cost edge.
+    const long long ALPHA = 8;
+    long long scale = n + 1, epsilon = 1;
+    for (size_t a = 0; a < net.arcs.size(); ++a) epsilon = std::max(epsilon, std::llabs(net.arcs[a].cost) * scale);
+    for (int v = 0; v < n; ++v) potential[v] *= scale;
+    std::vector<long long> excess(n, 0);
+    excess[s] += flow;
+    excess[t] -= flow;
+
+    std::vector<int> current(n), queue;
+    std::vector<bool> queued(n, false);
+    auto reduced = [&](int u, const CostNetwork::Arc& arc) {
+        return arc.cost * scale + potential[u] - potential[arc.to];
+    };
+    while (flow > 0) {
+        epsilon = std::max(1LL, epsilon / ALPHA);
+
+        // Saturate every arc of negative reduced cost: the pseudoflow is then 0-optimal,
+        // and what is left is to discharge the excess it created.
+        for (int u = 0; u < n; ++u)
+            for (int a = net.first[u]; a < net.first[u + 1]; ++a) {
+                CostNetwork::Arc& arc = net.arcs[a];
+                if (arc.cap > 0 && reduced(u, arc) < 0) {
+                    excess[u] -= arc.cap;
+                    excess[arc.to] += arc.cap;
+                    net.push(a, arc.cap);
+                }
+            }
+        queue.clear();
+        for (int v = 0; v < n; ++v) {
+            current[v] = net.first[v];
+            queued[v] = excess[v] > 0;
+            if (queued[v]) queue.push_back(v);
+        }
+
+        // FIFO discharge; admissible arcs have residual capacity and negative reduced cost.
+        for (size_t head = 0; head < queue.size(); ++head) {
+            int u = queue[head];
+            queued[u] = false;
+            while (excess[u] > 0) {
+                if (current[u] == net.first[u + 1]) {
+                    // Relabel: lower the potential until the best residual arc has reduced cost -epsilon.
+                    long long best = LLONG_MIN;
+                    for (int a = net.first[u]; a < net.first[u + 1]; ++a)
+                        if (net.arcs[a].cap > 0)
+                            best = std::max(best, potential[net.arcs[a].to] - net.arcs[a].cost * scale);
+                    potential[u] = best - epsilon;
+                    current[u] = net.first[u];
+                    continue;
+                }
+                int a = current[u];
+                CostNetwork::Arc& arc = net.arcs[a];
+                if (arc.cap > 0 && reduced(u, arc) < 0) {
+                    long long amount = std::min(excess[u], arc.cap);
+                    net.push(a, amount);
+                    excess[u] -= amount;
+                    excess[arc.to] += amount;
+                    if (excess[arc.to] > 0 && !queued[arc.to]) {
+                        queued[arc.to] = true;
+                        queue.push_back(arc.to);
+                    }
+                } else {
+                    ++current[u];
+                }
+            }
+        }
+        if (epsilon == 1) break;
+    }
+    net.collect(cost, edgeFlow);
+    return true;
+}
+
+std::string MinCostFlowAlgorithm::run(const Graph::Graph& graph) {
+    return run(graph, AlgorithmParams());
+}
+
+std::string MinCostFlowAlgorithm::run(const Graph::Graph& graph, const AlgorithmParams& params) {
+    int n = graph.numOfVertices();
+    int s, t;
+    std::string error = MaxFlowAlgorithm::readTerminals(graph, params, s, t);
+    if (!error.empty()) return error;
+    if (!graph.isDirected()) {
+        // Both directions of an undirected edge get an arc, so a negative cost is a negative 2-cycle.
+        for (int u = 0; u < n; ++u) {
+            const std::vector<int>& adj = graph.neighbors(u);
+            for (size_t i = 0; i < adj.size(); ++i)
+                if (graph.getEdgeCost(u, adj[i]) < 0) return "Negative edge costs need a directed graph";
+        }
+    }
+    long long limit = params.getInt("flow", -1);
+    if (limit < 0) limit = LLONG_MAX;
+
+    // Successive shortest paths runs one Dijkstra per augmenting path, and there can be as
+    // many paths as units leaving s; cost scaling does not depend on that number.
+    std::string mode = params.getString("mode", "auto");
+    if (mode == "auto") {
+        long long out = 0, edges = 0;
+        const std::vector<int>& adj = graph.neighbors(s);
+        for (size_t i = 0; i < adj.size(); ++i) out += graph.getEdgeWeight(s, adj[i]);
+        for (int u = 0; u < n; ++u) edges += graph.neighbors(u).size();
+        mode = std::min(out, limit) * edges > 100000000LL ? "scaling" : "ssp";
+    }
+
+    long long flow, cost;
+    std::vector<std::vector<long long>> edgeFlow;
+    bool ok;
+    if (mode == "ssp") ok = successiveShortestPaths(graph, s, t, limit, flow, cost, edgeFlow);
+    else if (mode == "scaling") ok = costScaling(graph, s, t, limit, flow, cost, edgeFlow);
+    else return "Unknown mode: " + mode + " (use auto, ssp or scaling)";
+    if (!ok) return "Negative cost cycles are not supported";
+
+    std::ostringstream out;
+    out << "Min-cost flow from " << s << " to " << t << " (" << mode << "): flow " << flow << ", cost " << cost;
+    out << "\n       Flow edges:";
+    bool first = true;
+    for (int u = 0; u < n; ++u) {
+        const std::vector<int>& adj = graph.neighbors(u);
+        for (size_t i = 0; i < adj.size(); ++i) {
+            if (edgeFlow[u][i] == 0) continue;
+            out << (first ? " " : ", ") << u << "->" << adj[i] << " " << edgeFlow[u][i] << "/"
+                << graph.getEdgeWeight(u, adj[i]) << " (cost " << graph.getEdgeCost(u, adj[i]) << ")";
+            first = false;
+        }
+    }
+    if (first) out << " none";
+    return out.str();
+}
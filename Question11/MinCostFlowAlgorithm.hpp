@@ -0,0 +1,46 @@
+#ifndef MIN_COST_FLOW_ALGORITHM_HPP
+#define MIN_COST_FLOW_ALGORITHM_HPP
+
+#include "GraphAlgorithm.hpp"
+#include <vector>
+
+/**
+ * @brief Minimum-cost maximum flow, with edge weights as capacities and edge costs per unit
+ * @details Every edge gets its own residual arc pair (antiparallel edges may differ in cost).
+ *          Successive shortest paths augments along a cheapest path found by a radix-heap
+ *          Dijkstra on costs reduced by Johnson potentials, so reduced costs stay non-negative.
+ *          Cost scaling first finds the max-flow value with push-relabel, then routes it by
+ *          Goldberg-Tarjan refinement: costs are scaled by n+1, and each phase pushes excess
+ *          along arcs of negative reduced cost until the flow is epsilon-optimal, dividing
+ *          epsilon by 8 down to 1. Its running time does not depend on the flow value.
+ *          Negative costs are allowed on directed graphs as long as no cycle of edges has a
+ *          negative total.
+ */
+class MinCostFlowAlgorithm : public GraphAlgorithm {
+public:
+    std::string run(const Graph::Graph& graph) override;
+    // Options: s=<source> t=<sink> (default 0 and n-1), flow=<k> send at most k units
+    //          (default: the maximum flow), mode=auto|ssp|scaling
+    std::string run(const Graph::Graph& graph, const AlgorithmParams& params) override;
+
+    /**
+     * @brief Cheapest flow of the largest value up to 'limit', by successive shortest paths
+     * @param graph source graph (weights are capacities, getEdgeCost the cost per unit)
+     * @param s source vertex
+     * @param t sink vertex
+     * @param limit most units to send
+     * @param flow receives the amount sent
+     * @param cost receives its total cost
+     * @param edgeFlow receives edgeFlow[u][i], the flow on the edge to graph.neighbors(u)[i]
+     * @return false if the edges have a negative-cost cycle, which is not supported (nothing
+     *         is computed then)
+     */
+    static bool successiveShortestPaths(const Graph::Graph& graph, int s, int t, long long limit, long long& flow,
+                                        long long& cost, std::vector<std::vector<long long>>& edgeFlow);
+
+    // Same contract as successiveShortestPaths, by cost scaling.
+    static bool costScaling(const Graph::Graph& graph, int s, int t, long long limit, long long& flow,
+                            long long& cost, std::vector<std::vector<long long>>& edgeFlow);
+};
+
+#endif // MIN_COST_FLOW_ALGORITHM_HPP
@@ -0,0 +1,338 @@
+#include "MinCutAlgorithm.hpp"
+#include "ThreadPool.hpp"
+#include "UnionFind.hpp"
+#include <algorithm>
+#include <climits>
+#include <cmath>
+#include <queue>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace {
+
+struct Edge {
+    int u, v;
+    long long w;
+};
+
+// Put vertex 0 on side 0.
+void normalize(std::vector<int>& side) {
+    if (!side.empty() && side[0] == 1)
+        for (size_t v = 0; v < side.size(); ++v) side[v] ^= 1;
+}
+
+// Contract k vertices down to 'target' (or fewer components if the edges run out first).
+// Taking edges in order of exponential keys -ln(U)/w is the same as repeatedly picking a
+// random edge with probability proportional to its weight. Returns the new vertex count;
+// label[i] is the new id of vertex i, and the edges between new vertices are merged.
+int contract(const std::vector<Edge>& edges, int k, int target, std::mt19937_64& rng, std::vector<int>& label,
+             std::vector<Edge>& out) {
+    std::uniform_real_distribution<double> uniform(0.0, 1.0);
+    std::vector<std::pair<double, int>> order(edges.size());
+    for (size_t i = 0; i < edges.size(); ++i) order[i] = std::make_pair(-std::log(1.0 - uniform(rng)) / edges[i].w, (int)i);
+
+    // Only the smallest keys get used, so they are selected and sorted in growing batches.
+    UnionFind uf(k);
+    size_t done = 0, batch = std::max(1, k - target);
+    while (done < order.size() && uf.count() > target) {
+        size_t end = std::min(order.size(), done + batch);
+        if (end < order.size()) std::nth_element(order.begin() + done, order.begin() + end, order.end());
+        std::sort(order.begin() + done, order.begin() + end);
+        for (; done < end && uf.count() > target; ++done)
+            uf.unite(edges[order[done].second].u, edges[order[done].second].v);
+        batch *= 2;
+    }
+
+    label.assign(k, -1);
+    int c = 0;
+    for (int i = 0; i < k; ++i)
+        if (label[uf.find(i)] < 0) label[uf.find(i)] = c++;
+    for (int i = 0; i < k; ++i) label[i] = label[uf.find(i)];
+
+    // Bucket the surviving edges by their smaller endpoint, then merge parallel ones.
+    std::vector<int> start(c + 1, 0);
+    for (size_t i = 0; i < edges.size(); ++i) {
+        int a = label[edges[i].u], b = label[edges[i].v];
+        if (a != b) ++start[std::min(a, b) + 1];
+    }
+    for (int v = 0; v < c; ++v) start[v + 1] += start[v];
+    std::vector<Edge> bucket(start[c]);
+    std::vector<int> pos(start.begin(), start.end() - 1);
+    for (size_t i = 0; i < edges.size(); ++i) {
+        int a = label[edges[i].u], b = label[edges[i].v];
+        if (a == b) continue;
+        Edge e = { std::min(a, b), std::max(a, b), edges[i].w };
+        bucket[pos[e.u]++] = e;
+    }
+    out.clear();
+    std::vector<int> slot(c, -1); // index in out of the edge u-v for the current u
+    for (int u = 0; u < c; ++u) {
+        int row = (int)out.size();
+        for (int i = start[u]; i < start[u + 1]; ++i) {
+            int v = bucket[i].v;
+            if (slot[v] >= row) {
+                out[slot[v]].w += bucket[i].w;
+            } else {
+                slot[v] = (int)out.size();
+                out.push_back(bucket[i]);
+            }
+        }
+    }
+    return c;
+}
+
+// Below this many vertices the recursion would shrink by one vertex per level, so the
+// rest is solved exactly.
+const int EXACT = 24;
+
+// Stoer-Wagner on an adjacency matrix, O(k^3), for the small graphs at the bottom of Karger-Stein.
+long long denseCut(const std::vector<Edge>& edges, int k, std::vector<int>& side) {
+    std::vector<long long> w(k * k, 0);
+    for (size_t i = 0; i < edges.size(); ++i) {
+        w[edges[i].u * k + edges[i].v] += edges[i].w;
+        w[edges[i].v * k + edges[i].u] += edges[i].w;
+    }
+    std::vector<int> group(k), alive(k);
+    for (int v = 0; v < k; ++v) group[v] = alive[v] = v;
+    std::vector<long long> key(k);
+    std::vector<char> added(k);
+    long long best = LLONG_MAX;
+    while (alive.size() > 1) {
+        for (size_t i = 0; i < alive.size(); ++i) {
+            key[alive[i]] = 0;
+            added[alive[i]] = 0;
+        }
+        int prev = -1, last = -1;
+        for (size_t step = 0; step < alive.size(); ++step) {
+            int v = -1;
+            for (size_t i = 0; i < alive.size(); ++i)
+                if (!added[alive[i]] && (v < 0 || key[alive[i]] > key[v])) v = alive[i];
+            added[v] = 1;
+            prev = last;
+            last = v;
+            for (size_t i = 0; i < alive.size(); ++i) key[alive[i]] += w[v * k + alive[i]];
+        }
+        if (key[last] < best) {
+            best = key[last];
+            for (int v = 0; v < k; ++v) side[v] = group[v] == last;
+        }
+        for (size_t i = 0; i < alive.size(); ++i) {
+            int x = alive[i];
+            w[prev * k + x] += w[last * k + x];
+            w[x * k + prev] = w[prev * k + x];
+        }
+        w[prev * k + prev] = 0;
+        for (int v = 0; v < k; ++v)
+            if (group[v] == last) group[v] = prev;
+        alive.erase(std::find(alive.begin(), alive.end(), last));
+    }
+    return best;
+}
+
+long long fastCut(const std::vector<Edge>& edges, int k, std::mt19937_64& rng, std::vector<int>& side) {
+    side.assign(k, 0);
+    if (edges.empty()) {
+        side[k - 1] = 1;
+        return 0;
+    }
+    if (k <= EXACT) return denseCut(edges, k, side);
+
+    int target = (int)std::ceil(1 + k / std::sqrt(2.0));
+    long long best = LLONG_MAX;
+    std::vector<int> label, inner;
+    std::vector<Edge> smaller;
+    for (int branch = 0; branch < 2; ++branch) {
+        int c = contract(edges, k, target, rng, label, smaller);
+        long long cut = fastCut(smaller, c, rng, inner);
+        if (cut < best) {
+            best = cut;
+            for (int v = 0; v < k; ++v) side[v] = inner[label[v]];
+        }
+    }
+    return best;
+}
+
+}
+
+long long MinCutAlgorithm::stoerWagner(const Graph::Graph& graph, std::vector<int>& side) {
+    int n = graph.numOfVertices();
+    typedef std::pair<int, long long> Link; // endpoint (any vertex of its merged group), weight
+
+    std::vector<std::vector<Link>> adj(n);
+    std::vector<std::vector<int>> members(n);
+    std::vector<int> alive(n);
+    for (int u = 0; u < n; ++u) {
+        const std::vector<int>& out = graph.neighbors(u);
+        for (size_t i = 0; i < out.size(); ++i) adj[u].push_back(Link(out[i], graph.getEdgeWeight(u, out[i])));
+        members[u].push_back(u);
+        alive[u] = u;
+    }
+
+    UnionFind merged(n);
+    std::vector<long long> key(n);
+    std::vector<bool> added(n);
+    std::vector<int> slot(n, -1); // position of a group in the links being merged
+    long long best = LLONG_MAX;
+    std::vector<int> bestGroup;
+    while (alive.size() > 1) {
+        // Maximum adjacency order: always add the vertex most tightly connected to those added.
+        std::priority_queue<std::pair<long long, int>> heap;
+        for (size_t i = 0; i < alive.size(); ++i) {
+            key[alive[i]] = 0;
+            added[alive[i]] = false;
+            heap.push(std::make_pair(0LL, alive[i]));
+        }
+        int prev = -1, last = -1;
+        long long lastKey = 0;
+        while (!heap.empty()) {
+            std::pair<long long, int> top = heap.top();
+            heap.pop();
+            int v = top.second;
+            if (added[v] || top.first != key[v]) continue; // stale entry
+            added[v] = true;
+            prev = last;
+            last = v;
+            lastKey = top.first;
+            // Resolve endpoints to their group, drop links that became internal and merge
+            // parallel ones, so later phases walk one link per neighboring group.
+            std::vector<Link>& links = adj[v];
+            size_t m = 0;
+            for (size_t i = 0; i < links.size(); ++i) {
+                int r = merged.find(links[i].first);
+                long long w = links[i].second;
+                if (r == v) continue;
+                if (slot[r] < 0) {
+                    slot[r] = (int)m;
+                    links[m++] = Link(r, 0);
+                }
+                links[slot[r]].second += w;
+            }
+            links.resize(m);
+            for (size_t i = 0; i < m; ++i) {
+                int r = links[i].first;
+                slot[r] = -1;
+                if (!added[r]) {
+                    key[r] += links[i].second;
+                    heap.push(std::make_pair(key[r], r));
+                }
+            }
+        }
+
+        // The cut of the phase separates 'last' from everything else.
+        if (lastKey < best) {
+            best = lastKey;
+            bestGroup = members[last];
+        }
+        merged.unite(prev, last);
+        int keep = merged.find(prev), gone = keep == prev ? last : prev;
+        adj[keep].insert(adj[keep].end(), adj[gone].begin(), adj[gone].end());
+        members[keep].insert(members[keep].end(), members[gone].begin(), members[gone].end());
+        std::vector<Link>().swap(adj[gone]);
+        std::vector<int>().swap(members[gone]);
+        alive.erase(std::find(alive.begin(), alive.end(), gone));
+    }
+
+    side.assign(n, 0);
+    for (size_t i = 0; i < bestGroup.size(); ++i) side[bestGroup[i]] = 1;
+    normalize(side);
+    return best;
+}
+
+long long MinCutAlgorithm::kargerStein(const Graph::Graph& graph, int trials, unsigned seed, std::vector<int>& side) {
+    int n = graph.numOfVertices();
+    std::vector<Edge> edges;
+    for (int u = 0; u < n; ++u) {
+        const std::vector<int>& out = graph.neighbors(u);
+        for (size_t i = 0; i < out.size(); ++i)
+            if (u < out[i]) {
+                Edge e = { u, out[i], graph.getEdgeWeight(u, out[i]) };
+                edges.push_back(e);
+            }
+    }
+
+    // Each trial has its own generator, and each task keeps only its best cut (the earliest
+    // trial on ties), so the result does not depend on scheduling or the number of tasks.
+    ThreadPool& pool = ThreadPool::shared();
+    int tasks = std::min(trials, 4 * (int)pool.size());
+    std::vector<long long> cut(tasks, LLONG_MAX);
+    std::vector<std::vector<int>> sides(tasks);
+    pool.parallelFor(0, tasks, [&](int lo, int hi) {
+        std::vector<int> trialSide;
+        for (int t = lo; t < hi; ++t) {
+            int first = (int)((long long)trials * t / tasks), last = (int)((long long)trials * (t + 1) / tasks);
+            for (int i = first; i < last; ++i) {
+                std::seed_seq seq{ seed, (unsigned)i };
+                std::mt19937_64 rng(seq);
+                long long c = fastCut(edges, n, rng, trialSide);
+                if (c < cut[t]) {
+                    cut[t] = c;
+                    sides[t].swap(trialSide);
+                }
+            }
+        }
+    }, 1);
+
+    int best = (int)(std::min_element(cut.begin(), cut.end()) - cut.begin());
+    side = sides[best];
+    normalize(side);
+    return cut[best];
+}
+
+std::string MinCutAlgorithm::run(const Graph::Graph& graph) {
+    return run(graph, AlgorithmParams());
+}
+
+std::string MinCutAlgorithm::run(const Graph::Graph& graph, const AlgorithmParams& params) {
+    int n = graph.numOfVertices();
+    if (graph.isDirected()) return "Global min cut needs an undirected graph";
+    if (n < 2) return "Global min cut needs at least 2 vertices";
+    for (int u = 0; u < n; ++u) {
+        const std::vector<int>& adj = graph.neighbors(u);
+        for (size_t i = 0; i < adj.size(); ++i)
+            if (graph.getEdgeWeight(u, adj[i]) < 0) return "Negative edge weights are not supported";
+    }
+
+    std::string mode = params.getString("mode", "sw");
+    std::vector<int> side;
+    long long cut;
+    std::string label;
+    if (mode == "sw") {
+        cut = stoerWagner(graph, side);
+        label = "stoer-wagner";
+    } else if (mode == "karger") {
+        // ceil(log2 n)^2 trials already find the minimum with high probability; more only cost time.
+        int log2n = (int)std::ceil(std::log2((double)n));
+        int trials = std::max(1, std::min(4 * log2n * log2n, params.getInt("trials", log2n)));
+        cut = kargerStein(graph, trials, (unsigned)params.getInt("seed", 1), side);
+        label = "karger-stein, " + std::to_string(trials) + " trials";
+    } else {
+        return "Unknown mode: " + mode + " (use sw or karger)";
+    }
+
+    std::string result = "Global min cut (" + label + "): " + std::to_string(cut);
+    for (int s = 0; s < 2; ++s) {
+        result += s == 0 ? "\n       Side A:" : "\n       Side B:";
+        bool first = true;
+        for (int v = 0; v < n; ++v) {
+            if (side[v] != s) continue;
+            result += (first ? " " : ", ") + std::to_string(v);
+            first = false;
+        }
+    }
+    result += "\n       Cut edges:";
+    bool first = true;
+    for (int u = 0; u < n; ++u) {
+        const std::vector<int>& adj = graph.neighbors(u);
+        for (size_t i = 0; i < adj.size(); ++i) {
+            int v = adj[i];
+            if (u > v || side[u] == side[v]) continue;
+            result += (first ? " " : ", ") + std::to_string(u) + "-" + std::to_string(v) + " (" +
+                      std::to_string(graph.getEdgeWeight(u, v)) + ")";
+            first = false;
+        }
+    }
+    if (first) result += " none";
+    return result;
+}
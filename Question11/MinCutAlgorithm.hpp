@@ -0,0 +1,32 @@
+#ifndef MIN_CUT_ALGORITHM_HPP
+#define MIN_CUT_ALGORITHM_HPP
+
+#include "GraphAlgorithm.hpp"
+#include <vector>
+
+/**
+ * @brief Global minimum cut of an undirected graph (no terminals), edge weights as capacities
+ * @details Stoer-Wagner runs n-1 phases. Each phase builds a maximum adjacency order with a
+ *          lazy binary heap, takes the cut around the last vertex and merges the last two.
+ *          Merged vertices are tracked in a UnionFind, so edge endpoints are resolved lazily
+ *          and the lists of merged vertices are simply concatenated.
+ *          Karger-Stein contracts random edges (chosen with probability proportional to their
+ *          weight, as Kruskal over exponential keys on a UnionFind) down to n/sqrt(2) vertices
+ *          twice and recurses on both; graphs of at most 24 vertices are solved exactly.
+ *          Independent trials run on the shared ThreadPool and the smallest cut found wins.
+ *          A trial finds the minimum with probability about 1/log n, so the answer is only
+ *          likely to be optimal; more trials make it more likely.
+ */
+class MinCutAlgorithm : public GraphAlgorithm {
+public:
+    std::string run(const Graph::Graph& graph) override;
+    // Options: mode=sw|karger (default sw), trials=<k> Karger-Stein runs (default ceil(log2 n),
+    //          at most 4 ceil(log2 n)^2), seed=<s> (1)
+    std::string run(const Graph::Graph& graph, const AlgorithmParams& params) override;
+
+    // Both return the cut weight; side[v] is 0 for the side of vertex 0 and 1 for the other.
+    static long long stoerWagner(const Graph::Graph& graph, std::vector<int>& side);
+    static long long kargerStein(const Graph::Graph& graph, int trials, unsigned seed, std::vector<int>& side);
+};
+
+#endif // MIN_CUT_ALGORITHM_HPP
@@ -0,0 +1,97 @@
+#include "PageRankAlgorithm.hpp"
+#include "SparseMatrix.hpp"
+#include "ThreadPool.hpp"
+#include <algorithm>
+#include <cmath>
+#include <sstream>
+#include <string>
+#include <vector>
+
+int PageRankAlgorithm::pageRank(const Graph::Graph& graph, double damping, const std::vector<double>& teleport,
+                                bool weighted, double tol, int maxIter, std::vector<double>& rank) {
+    int n = graph.numOfVertices();
+
+    // Transition matrix, pulled: row v holds u -> v with the probability of taking that edge from u.
+    std::vector<SparseMatrix::Entry> entries;
+    std::vector<bool> dangling(n, false);
+    for (int u = 0; u < n; ++u) {
+        const std::vector<int>& adj = graph.neighbors(u);
+        double total = 0;
+        for (size_t i = 0; i < adj.size(); ++i) total += weighted ? graph.getEdgeWeight(u, adj[i]) : 1.0;
+        if (total <= 0) {
+            dangling[u] = true;
+            continue;
+        }
+        for (size_t i = 0; i < adj.size(); ++i) {
+            double w = weighted ? graph.getEdgeWeight(u, adj[i]) : 1.0;
+            SparseMatrix::Entry e = { adj[i], u, w / total };
+            entries.push_back(e);
+        }
+    }
+    SparseMatrix transition(n, n, entries);
+
+    // The change is summed per fixed block of vertices, then over the blocks in order, so the
+    // stop test (and with it the result) does not depend on the thread count or scheduling.
+    const int BLOCK = 1024;
+    ThreadPool& pool = ThreadPool::shared();
+    std::vector<double> blockChange((n + BLOCK - 1) / BLOCK);
+    rank = teleport;
+    std::vector<double> pulled;
+    int iter = 0;
+    while (iter < maxIter) {
+        ++iter;
+        double danglingRank = 0;
+        for (int v = 0; v < n; ++v)
+            if (dangling[v]) danglingRank += rank[v];
+
+        transition.multiply(rank, pulled);
+
+        // Random jumps and rank stuck at dangling vertices both follow the teleport vector.
+        double jump = (1 - damping) + damping * danglingRank;
+        std::fill(blockChange.begin(), blockChange.end(), 0.0);
+        pool.parallelFor(0, n, [&](int lo, int hi) {
+            for (int v = lo; v < hi; ++v) {
+                double next = damping * pulled[v] + jump * teleport[v];
+                blockChange[v / BLOCK] += std::fabs(next - rank[v]);
+                rank[v] = next;
+            }
+        }, BLOCK);
+        double change = 0;
+        for (size_t b = 0; b < blockChange.size(); ++b) change += blockChange[b];
+        if (change < tol) break;
+    }
+    return iter;
+}
+
+std::string PageRankAlgorithm::run(const Graph::Graph& graph) {
+    return run(graph, AlgorithmParams());
+}
+
+std::string PageRankAlgorithm::run(const Graph::Graph& graph, const AlgorithmParams& params) {
+    int n = graph.numOfVertices();
+    double damping = params.getDouble("damping", 0.85);
+    if (damping < 0 || damping >= 1) return "Invalid damping: must be in [0, 1)";
+    double tol = params.getDouble("tol", 1e-10);
+    int maxIter = params.getInt("maxiter", 100);
+
+    std::vector<double> teleport(n, 1.0 / n);
+    std::vector<int> personal = params.getIntList("personalize");
+    if (!personal.empty()) {
+        std::fill(teleport.begin(), teleport.end(), 0.0);
+        for (size_t i = 0; i < personal.size(); ++i) {
+            if (personal[i] < 0 || personal[i] >= n)
+                return "Invalid personalize: vertices must be between 0 and " + std::to_string(n - 1);
+            teleport[personal[i]] += 1.0 / personal.size();
+        }
+    }
+
+    std::vector<double> rank;
+    int iterations = pageRank(graph, damping, teleport, params.getBool("weighted", false), tol, maxIter, rank);
+
+    std::vector<int> top = topVertices(rank, params.getInt("top", 10));
+
+    std::ostringstream out;
+    out << "PageRank after " << iterations << " iterations, top " << top.size() << ":";
+    for (size_t i = 0; i < top.size(); ++i) out << "\n       " << top[i] << ": " << rank[top[i]];
+    return out.str();
+}
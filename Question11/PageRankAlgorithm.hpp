@@ -0,0 +1,36 @@
+#ifndef PAGE_RANK_ALGORITHM_HPP
+#define PAGE_RANK_ALGORITHM_HPP
+
+#include "GraphAlgorithm.hpp"
+#include <vector>
+
+/**
+ * @brief PageRank by power iteration on a SparseMatrix
+ * @details The matrix has one row per vertex holding its in-edges, weighted 1/outdeg of the
+ *          source (or w / total out-weight), so every iteration is one pull-based SpMV. Rank of
+ *          dangling vertices and the teleport share go to the teleport vector: uniform, or
+ *          spread over the 'personalize' vertices for personalized PageRank.
+ */
+class PageRankAlgorithm : public GraphAlgorithm {
+public:
+    std::string run(const Graph::Graph& graph) override;
+    // Options: damping=<d> (0.85), tol=<L1 change> (1e-10), maxiter=<n> (100), weighted=1,
+    //          personalize=v1,v2,... teleport to these vertices only, top=<k> ranks to report (10)
+    std::string run(const Graph::Graph& graph, const AlgorithmParams& params) override;
+
+    /**
+     * @brief Iterate until the L1 change drops below tol or maxIter is reached
+     * @param graph source graph
+     * @param damping probability of following an edge
+     * @param teleport teleport distribution (sums to 1), size n
+     * @param weighted use edge weights as transition weights
+     * @param tol convergence threshold on the L1 change
+     * @param maxIter iteration limit
+     * @param rank filled with the ranks (sum 1)
+     * @return int number of iterations run
+     */
+    static int pageRank(const Graph::Graph& graph, double damping, const std::vector<double>& teleport,
+                        bool weighted, double tol, int maxIter, std::vector<double>& rank);
+};
+
+#endif // PAGE_RANK_ALGORITHM_HPP
@@ -0,0 +1,211 @@
+#include "ParallelSCCAlgorithm.hpp"
+#include "SCCAlgorithm.hpp"
+#include "ThreadPool.hpp"
+#include <atomic>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace {
+
+// Compressed adjacency: the neighbors of v are target[offset[v]] .. target[offset[v+1]-1].
+struct Csr {
+    std::vector<int> offset;
+    std::vector<int> target;
+};
+
+void buildCsr(const Graph::Graph& g, Csr& out, Csr& in) {
+    int n = g.numOfVertices();
+    out.offset.assign(n + 1, 0);
+    in.offset.assign(n + 1, 0);
+    for (int v = 0; v < n; ++v) {
+        const std::vector<int>& adj = g.neighbors(v);
+        out.offset[v + 1] = out.offset[v] + (int)adj.size();
+        for (size_t i = 0; i < adj.size(); ++i) ++in.offset[adj[i] + 1];
+    }
+    for (int v = 0; v < n; ++v) in.offset[v + 1] += in.offset[v];
+    out.target.resize(out.offset[n]);
+    in.target.resize(in.offset[n]);
+    std::vector<int> pos(in.offset.begin(), in.offset.end() - 1);
+    for (int v = 0; v < n; ++v) {
+        const std::vector<int>& adj = g.neighbors(v);
+        for (size_t i = 0; i < adj.size(); ++i) {
+            out.target[out.offset[v] + i] = adj[i];
+            in.target[pos[adj[i]]++] = v;
+        }
+    }
+}
+
+// Level-synchronous BFS from 'source' over alive vertices; every reached vertex gets seen = 1.
+void parallelReach(const Csr& adj, int source, const std::vector<char>& alive,
+                   std::vector<std::atomic<char>>& seen, ThreadPool& pool) {
+    std::vector<int> frontier(1, source);
+    seen[source].store(1);
+    std::mutex m;
+    while (!frontier.empty()) {
+        std::vector<int> next;
+        pool.parallelFor(0, (int)frontier.size(), [&](int lo, int hi) {
+            std::vector<int> local;
+            for (int i = lo; i < hi; ++i) {
+                int v = frontier[i];
+                for (int e = adj.offset[v]; e < adj.offset[v + 1]; ++e) {
+                    int w = adj.target[e];
+                    if (alive[w] && !seen[w].load(std::memory_order_relaxed) && !seen[w].exchange(1))
+                        local.push_back(w);
+                }
+            }
+            std::lock_guard<std::mutex> lk(m);
+            next.insert(next.end(), local.begin(), local.end());
+        });
+        frontier.swap(next);
+    }
+}
+
+}
+
+int ParallelSCCAlgorithm::components(const Graph::Graph& graph, std::vector<int>& comp) {
+    int n = graph.numOfVertices();
+    Csr out, in;
+    buildCsr(graph, out, in);
+    ThreadPool& pool = ThreadPool::shared();
+
+    comp.assign(n, -1);
+    std::vector<char> alive(n, 1);
+    std::atomic<int> count(0);
+    int remaining = n;
+
+    // 1. Trimming: a vertex without alive in- or out-neighbors is an SCC on its own.
+    //    Rounds stop paying off on long chains, so stop once one removes under 1%.
+    std::vector<char> trim(n, 0);
+    for (;;) {
+        std::atomic<int> removed(0);
+        pool.parallelFor(0, n, [&](int lo, int hi) {
+            int local = 0;
+            for (int v = lo; v < hi; ++v) {
+                trim[v] = 0;
+                if (!alive[v]) continue;
+                bool hasOut = false, hasIn = false;
+                for (int e = out.offset[v]; e < out.offset[v + 1] && !hasOut; ++e) hasOut = alive[out.target[e]] != 0;
+                for (int e = in.offset[v]; e < in.offset[v + 1] && !hasIn; ++e) hasIn = alive[in.target[e]] != 0;
+                if (!hasOut || !hasIn) { trim[v] = 1; ++local; }
+            }
+            removed.fetch_add(local);
+        });
+        for (int v = 0; v < n; ++v)
+            if (trim[v]) { alive[v] = 0; comp[v] = count++; }
+        remaining -= removed.load();
+        if (removed.load() == 0 || removed.load() * 100 < remaining) break;
+    }
+
+    // 2. Forward-backward from the pivot most likely to sit in the giant component.
+    if (remaining > 0) {
+        int pivot = -1;
+        long long best = -1;
+        for (int v = 0; v < n; ++v) {
+            if (!alive[v]) continue;
+            long long score = (long long)(out.offset[v + 1] - out.offset[v]) * (in.offset[v + 1] - in.offset[v]);
+            if (score > best) { best = score; pivot = v; }
+        }
+        std::vector<std::atomic<char>> fw(n), bw(n);
+        for (int v = 0; v < n; ++v) { fw[v].store(0); bw[v].store(0); }
+        parallelReach(out, pivot, alive, fw, pool);
+        parallelReach(in, pivot, alive, bw, pool);
+        int id = count++;
+        std::atomic<int> taken(0);
+        pool.parallelFor(0, n, [&](int lo, int hi) {
+            int local = 0;
+            for (int v = lo; v < hi; ++v)
+                if (fw[v].load() && bw[v].load()) { comp[v] = id; alive[v] = 0; ++local; }
+            taken.fetch_add(local);
+        });
+        remaining -= taken.load();
+    }
+
+    // 3. Coloring: propagate the largest vertex id forward; a vertex that keeps its own id
+    //    is the root of an SCC made of the same-colored vertices that can reach it.
+    std::vector<std::atomic<int>> color(n);
+    while (remaining > 0) {
+        std::vector<int> rest;
+        rest.reserve(remaining);
+        for (int v = 0; v < n; ++v)
+            if (alive[v]) { rest.push_back(v); color[v].store(v); }
+
+        std::atomic<bool> changed(true);
+        while (changed.load()) {
+            changed.store(false);
+            pool.parallelFor(0, (int)rest.size(), [&](int lo, int hi) {
+                bool local = false;
+                for (int i = lo; i < hi; ++i) {
+                    int v = rest[i];
+                    int c = color[v].load();
+                    for (int e = out.offset[v]; e < out.offset[v + 1]; ++e) {
+                        int w = out.target[e];
+                        if (!alive[w]) continue;
+                        int cw = color[w].load();
+                        while (c > cw) {
+                            if (color[w].compare_exchange_weak(cw, c)) { local = true; break; }
+                        }
+                    }
+                }
+                if (local) changed.store(true);
+            });
+        }
+
+        std::vector<int> roots;
+        for (size_t i = 0; i < rest.size(); ++i)
+            if (color[rest[i]].load() == rest[i]) roots.push_back(rest[i]);
+
+        // Roots own disjoint color classes, so their backward searches never touch each other.
+        pool.parallelFor(0, (int)roots.size(), [&](int lo, int hi) {
+            std::vector<int> queue;
+            for (int i = lo; i < hi; ++i) {
+                int r = roots[i];
+                int id = count++;
+                queue.assign(1, r);
+                comp[r] = id;
+                for (size_t head = 0; head < queue.size(); ++head) {
+                    int v = queue[head];
+                    for (int e = in.offset[v]; e < in.offset[v + 1]; ++e) {
+                        int w = in.target[e];
+                        if (alive[w] && color[w].load() == r && comp[w] == -1) {
+                            comp[w] = id;
+                            queue.push_back(w);
+                        }
+                    }
+                }
+            }
+        }, 1);
+
+        for (size_t i = 0; i < rest.size(); ++i)
+            if (comp[rest[i]] != -1) { alive[rest[i]] = 0; --remaining; }
+    }
+
+    SCCAlgorithm::relabelBySmallestVertex(comp, count.load());
+    return count.load();
+}
+
+void ParallelSCCAlgorithm::condense(const Graph::Graph& graph, Condensation& out) {
+    out.count = components(graph, out.comp);
+    std::vector<std::pair<int, int>> edges;
+    for (int v = 0; v < graph.numOfVertices(); ++v) {
+        const std::vector<int>& adj = graph.neighbors(v);
+        for (size_t i = 0; i < adj.size(); ++i)
+            if (out.comp[v] != out.comp[adj[i]]) edges.push_back(std::make_pair(out.comp[v], out.comp[adj[i]]));
+    }
+    out.setEdges(edges);
+}
+
+std::string ParallelSCCAlgorithm::run(const Graph::Graph& graph) {
+    std::vector<int> comp;
+    int count = components(graph, comp);
+    return SCCAlgorithm::describe(comp, count);
+}
+
+std::string ParallelSCCAlgorithm::run(const Graph::Graph& graph, const AlgorithmParams& params) {
+    std::string format = params.getString("format", "list");
+    if (format == "list") return run(graph);
+    Condensation cond;
+    condense(graph, cond);
+    std::string result = SCCAlgorithm::describe(cond, format);
+    return result.empty() ? "Unknown format: " + format + " (use list, dag or binary)" : result;
+}
@@ -0,0 +1,28 @@
+#ifndef PARALLEL_SCC_ALGORITHM_HPP
+#define PARALLEL_SCC_ALGORITHM_HPP
+
+#include "GraphAlgorithm.hpp"
+#include "Condensation.hpp"
+#include <vector>
+
+/**
+ * @brief Strongly connected components on the shared ThreadPool
+ * @details Multistep decomposition: parallel trimming of trivial SCCs, one forward-backward
+ *          search from a high-degree pivot for the giant component, then label propagation
+ *          (coloring) with backward searches for whatever remains. Components are numbered
+ *          like SCCAlgorithm's, so both strategies produce identical output.
+ */
+class ParallelSCCAlgorithm : public GraphAlgorithm {
+public:
+    std::string run(const Graph::Graph& graph) override;
+    // Options: same formats as SCCAlgorithm
+    std::string run(const Graph::Graph& graph, const AlgorithmParams& params) override;
+
+    // Same contract as SCCAlgorithm::components.
+    static int components(const Graph::Graph& graph, std::vector<int>& comp);
+
+    // Same contract as SCCAlgorithm::condense (the DAG edges are gathered after the decomposition).
+    static void condense(const Graph::Graph& graph, Condensation& out);
+};
+
+#endif // PARALLEL_SCC_ALGORITHM_HPP
@@ -0,0 +1,288 @@
+#include "PushRelabelAlgorithm.hpp"
+#include "MaxFlowAlgorithm.hpp"
+#include "ThreadPool.hpp"
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace {
+
+// Exact distance-to-sink labels by a backward BFS over the residual arcs.
+// Vertices that cannot reach t (and the source) get label n.
+template <typename Residual>
+void globalRelabel(const FlowNetwork& net, int s, int t, std::vector<int>& label, Residual residual) {
+    int n = net.numOfVertices();
+    std::fill(label.begin(), label.end(), n);
+    label[t] = 0;
+    std::vector<int> queue;
+    queue.reserve(n);
+    queue.push_back(t);
+    for (size_t head = 0; head < queue.size(); ++head) {
+        int v = queue[head];
+        for (int a = net.arcBegin(v); a < net.arcEnd(v); ++a) {
+            int w = net.arc(a).to;
+            // w reaches v if the arc w->v (the reverse of v->w) still has capacity
+            if (label[w] == n && w != s && residual(net.arc(a).rev) > 0) {
+                label[w] = label[v] + 1;
+                queue.push_back(w);
+            }
+        }
+    }
+}
+
+// Send everything the source can push and return the resulting excesses.
+template <typename Push>
+void saturateSource(const FlowNetwork& net, int s, std::vector<long long>& excess, Push push) {
+    for (int a = net.arcBegin(s); a < net.arcEnd(s); ++a) {
+        long long c = push(a);
+        excess[net.arc(a).to] += c;
+        excess[s] -= c;
+    }
+}
+
+}
+
+long long PushRelabelAlgorithm::maxFlow(FlowNetwork& net, int s, int t) const {
+    if (s == t) return 0;
+    return parallel ? parallelFlow(net, s, t) : sequentialFlow(net, s, t);
+}
+
+long long PushRelabelAlgorithm::sequentialFlow(FlowNetwork& net, int s, int t) const {
+    int n = net.numOfVertices();
+    std::vector<long long> excess(n, 0);
+    std::vector<int> label(n), current(n), count(n + 1, 0);
+    std::vector<std::vector<int>> active(n); // active vertices bucketed by label
+    int highest = -1;
+
+    saturateSource(net, s, excess, [&](int a) {
+        FlowNetwork::Arc& e = net.arc(a);
+        long long c = e.cap;
+        e.cap = 0;
+        net.arc(e.rev).cap += c;
+        return c;
+    });
+
+    auto rebuild = [&]() {
+        globalRelabel(net, s, t, label, [&](int a) { return net.arc(a).cap; });
+        for (int b = 0; b < n; ++b) active[b].clear();
+        std::fill(count.begin(), count.end(), 0);
+        highest = -1;
+        for (int v = 0; v < n; ++v) {
+            ++count[label[v]];
+            current[v] = net.arcBegin(v);
+            if (v != s && v != t && excess[v] > 0 && label[v] < n) {
+                active[label[v]].push_back(v);
+                highest = std::max(highest, label[v]);
+            }
+        }
+    };
+
+    // Global relabel once the relabel work since the last one exceeds ~6n + m.
+    const long long relabelPeriod = 6LL * n + net.numOfArcs();
+    long long work = 0;
+    rebuild();
+
+    while (highest >= 0) {
+        if (active[highest].empty()) { --highest; continue; }
+        int v = active[highest].back();
+        active[highest].pop_back();
+        if (label[v] != highest || excess[v] == 0) continue; // lifted by a gap meanwhile
+
+        // Discharge v: push along admissible arcs, relabel when they run out.
+        while (excess[v] > 0) {
+            if (current[v] == net.arcEnd(v)) {
+                int old = label[v];
+                int newLabel = n;
+                for (int a = net.arcBegin(v); a < net.arcEnd(v); ++a)
+                    if (net.arc(a).cap > 0) newLabel = std::min(newLabel, label[net.arc(a).to] + 1);
+                work += 12 + net.arcEnd(v) - net.arcBegin(v);
+
+                if (count[old] == 1) {
+                    // Gap: nothing is left at label 'old', so nothing above it can reach t.
+                    for (int u = 0; u < n; ++u)
+                        if (label[u] > old && label[u] < n) {
+                            --count[label[u]];
+                            label[u] = n;
+                            ++count[n];
+                        }
+                    newLabel = n;
+                }
+                --count[old];
+                label[v] = std::min(newLabel, n);
+                ++count[label[v]];
+                current[v] = net.arcBegin(v);
+                if (label[v] >= n) break;
+                continue;
+            }
+
+            FlowNetwork::Arc& e = net.arc(current[v]);
+            if (e.cap > 0 && label[v] == label[e.to] + 1) {
+                long long delta = std::min(excess[v], e.cap);
+                e.cap -= delta;
+                net.arc(e.rev).cap += delta;
+                if (excess[e.to] == 0 && e.to != s && e.to != t) {
+                    active[label[e.to]].push_back(e.to);
+                    highest = std::max(highest, label[e.to]);
+                }
+                excess[e.to] += delta;
+                excess[v] -= delta;
+            } else {
+                ++current[v];
+            }
+        }
+
+        if (work > relabelPeriod) {
+            rebuild();
+            work = 0;
+        }
+    }
+    return excess[t];
+}
+
+long long PushRelabelAlgorithm::parallelFlow(FlowNetwork& net, int s, int t) const {
+    int n = net.numOfVertices();
+    int m = net.numOfArcs();
+    std::vector<std::atomic<long long>> cap(m);
+    for (int a = 0; a < m; ++a) cap[a].store(net.arc(a).cap);
+
+    std::vector<long long> excess(n, 0), remaining(n, 0);
+    std::vector<std::atomic<long long>> added(n); // excess received during the current round
+    for (int v = 0; v < n; ++v) added[v].store(0);
+    std::vector<int> label(n), newLabel(n);
+    std::vector<char> mark(n, 0);
+
+    saturateSource(net, s, excess, [&](int a) {
+        long long c = cap[a].exchange(0);
+        cap[net.arc(a).rev].fetch_add(c);
+        return c;
+    });
+
+    auto residual = [&](int a) { return cap[a].load(std::memory_order_relaxed); };
+    auto isActive = [&](int v) { return v != s && v != t && excess[v] > 0 && label[v] < n; };
+
+    std::vector<int> active;
+    auto rebuild = [&]() {
+        globalRelabel(net, s, t, label, residual);
+        active.clear();
+        for (int v = 0; v < n; ++v)
+            if (isActive(v)) active.push_back(v);
+    };
+
+    ThreadPool& pool = ThreadPool::shared();
+    const long long relabelPeriod = 6LL * n + m;
+    long long work = 0;
+    std::mutex discoveredMutex;
+    std::vector<int> discovered;
+    rebuild();
+
+    for (;;) {
+        if (active.empty()) {
+            // Round labels are only lower bounds; confirm with exact ones before stopping.
+            rebuild();
+            work = 0;
+            if (active.empty()) break;
+        }
+
+        std::atomic<long long> roundWork(0);
+        discovered.clear();
+
+        // Every active vertex is discharged against the labels and excesses of the previous
+        // round. Only v decreases the residual capacity of its own arcs; the paired reverse
+        // arcs and the receivers' excess are only ever increased, atomically.
+        pool.parallelFor(0, (int)active.size(), [&](int lo, int hi) {
+            std::vector<int> found;
+            long long localWork = 0;
+            for (int i = lo; i < hi; ++i) {
+                int v = active[i];
+                int d = label[v];
+                long long e = excess[v];
+                while (e > 0) {
+                    int relabelTo = n;
+                    bool skipped = false;
+                    for (int a = net.arcBegin(v); a < net.arcEnd(v) && e > 0; ++a) {
+                        long long c = cap[a].load(std::memory_order_relaxed);
+                        if (c == 0) continue;
+                        int w = net.arc(a).to;
+                        if (d == label[w] + 1) {
+                            // Two active endpoints must not push across the same pair in one
+                            // round - only the winner of the pair may use it.
+                            if (isActive(w)) {
+                                bool win = label[v] == label[w] + 1 || label[v] < label[w] - 1 ||
+                                           (label[v] == label[w] && v < w);
+                                if (!win) { skipped = true; continue; }
+                            }
+                            long long delta = std::min(e, c);
+                            cap[a].fetch_sub(delta);
+                            cap[net.arc(a).rev].fetch_add(delta);
+                            e -= delta;
+                            if (added[w].fetch_add(delta) == 0 && w != s && w != t) found.push_back(w);
+                        } else if (label[w] >= d) {
+                            relabelTo = std::min(relabelTo, label[w] + 1);
+                        }
+                    }
+                    if (e == 0 || skipped) break;
+                    localWork += 12 + net.arcEnd(v) - net.arcBegin(v);
+                    d = relabelTo;
+                    if (d >= n) { d = n; break; }
+                }
+                newLabel[v] = d;
+                remaining[v] = e;
+            }
+            roundWork.fetch_add(localWork);
+            if (!found.empty()) {
+                std::lock_guard<std::mutex> lk(discoveredMutex);
+                discovered.insert(discovered.end(), found.begin(), found.end());
+            }
+        });
+
+        // Apply the round: new labels, leftover excess, then the excess that arrived.
+        for (size_t i = 0; i < active.size(); ++i) {
+            int v = active[i];
+            label[v] = newLabel[v];
+            excess[v] = remaining[v];
+        }
+        for (size_t i = 0; i < discovered.size(); ++i) {
+            int w = discovered[i];
+            excess[w] += added[w].exchange(0);
+        }
+        excess[s] += added[s].exchange(0);
+        excess[t] += added[t].exchange(0);
+
+        std::vector<int> next;
+        for (size_t i = 0; i < active.size(); ++i) {
+            int v = active[i];
+            if (!mark[v] && isActive(v)) { mark[v] = 1; next.push_back(v); }
+        }
+        for (size_t i = 0; i < discovered.size(); ++i) {
+            int w = discovered[i];
+            if (!mark[w] && isActive(w)) { mark[w] = 1; next.push_back(w); }
+        }
+        for (size_t i = 0; i < next.size(); ++i) mark[next[i]] = 0;
+        active.swap(next);
+
+        work += roundWork.load();
+        if (work > relabelPeriod) {
+            rebuild();
+            work = 0;
+        }
+    }
+
+    for (int a = 0; a < m; ++a) net.arc(a).cap = cap[a].load();
+    return excess[t];
+}
+
+std::string PushRelabelAlgorithm::run(const Graph::Graph& graph) {
+    return run(graph, AlgorithmParams());
+}
+
+std::string PushRelabelAlgorithm::run(const Graph::Graph& graph, const AlgorithmParams& params) {
+    int s, t;
+    std::string error = MaxFlowAlgorithm::readTerminals(graph, params, s, t);
+    if (!error.empty()) return error;
+    FlowNetwork net(graph);
+    long long flow = maxFlow(net, s, t);
+    // The preflow is already maximal: the sink side is whatever still reaches t.
+    return MaxFlowAlgorithm::formatResult(graph, s, t, flow, net.sinkSide(t));
+}
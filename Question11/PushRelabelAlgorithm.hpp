@@ -0,0 +1,37 @@
+#ifndef PUSH_RELABEL_ALGORITHM_HPP
+#define PUSH_RELABEL_ALGORITHM_HPP
+
+#include "GraphAlgorithm.hpp"
+#include "FlowNetwork.hpp"
+#include <vector>
+
+/**
+ * @brief Max flow by highest-label push-relabel with global relabeling and the gap heuristic
+ * @details The parallel mode runs synchronous rounds: all active vertices are discharged
+ *          concurrently on the shared ThreadPool against the labels of the previous round,
+ *          with residual capacities and incoming excess updated atomically.
+ */
+class PushRelabelAlgorithm : public GraphAlgorithm {
+public:
+    explicit PushRelabelAlgorithm(bool parallel = false) : parallel(parallel) {}
+    std::string run(const Graph::Graph& graph) override;
+    // Options: s=<source> t=<sink> (default 0 and n-1)
+    std::string run(const Graph::Graph& graph, const AlgorithmParams& params) override;
+
+    /**
+     * @brief Compute the max-flow value, leaving the final preflow in the network
+     * @param net residual network (capacities are consumed)
+     * @param s source vertex
+     * @param t sink vertex
+     * @return long long value of the maximum flow
+     */
+    long long maxFlow(FlowNetwork& net, int s, int t) const;
+
+private:
+    bool parallel;
+
+    long long sequentialFlow(FlowNetwork& net, int s, int t) const;
+    long long parallelFlow(FlowNetwork& net, int s, int t) const;
+};
+
+#endif // PUSH_RELABEL_ALGORITHM_HPP
@@ -0,0 +1,59 @@
+#ifndef RADIX_HEAP_HPP
+#define RADIX_HEAP_HPP
+
+#include <utility>
+#include <vector>
+
+/**
+ * @brief Monotone priority queue for non-negative integer keys (radix heap)
+ * @details Bucket b holds the entries whose key first differs from the last popped key at bit
+ *          b-1 (bucket 0: equal keys). A pop that finds bucket 0 empty redistributes the first
+ *          non-empty bucket around its minimum; every entry only moves to lower buckets, so
+ *          each one is touched O(log C) times. Keys pushed must not be below the last popped
+ *          key, which Dijkstra guarantees for non-negative weights.
+ */
+class RadixHeap {
+public:
+    typedef unsigned long long Key;
+
+    RadixHeap() : last(0), count(0) {}
+
+    bool empty() const { return count == 0; }
+    size_t size() const { return count; }
+
+    void push(Key key, int value) {
+        buckets[bucketOf(key)].push_back(std::make_pair(key, value));
+        ++count;
+    }
+
+    /**
+     * @brief Remove an entry with the smallest key
+     * @return std::pair<Key, int> the key and its value
+     */
+    std::pair<Key, int> pop() {
+        if (buckets[0].empty()) {
+            int b = 1;
+            while (buckets[b].empty()) ++b;
+            Key smallest = buckets[b][0].first;
+            for (size_t i = 1; i < buckets[b].size(); ++i)
+                if (buckets[b][i].first < smallest) smallest = buckets[b][i].first;
+            last = smallest;
+            for (size_t i = 0; i < buckets[b].size(); ++i)
+                buckets[bucketOf(buckets[b][i].first)].push_back(buckets[b][i]);
+            buckets[b].clear();
+        }
+        std::pair<Key, int> top = buckets[0].back();
+        buckets[0].pop_back();
+        --count;
+        return top;
+    }
+
+private:
+    int bucketOf(Key key) const { return key == last ? 0 : 64 - __builtin_clzll(key ^ last); }
+
+    std::vector<std::pair<Key, int>> buckets[65]; ///< Entries by highest bit differing from 'last'
+    Key last;                                     ///< Last popped key
+    size_t count;                                 ///< Number of entries
+};
+
+#endif // RADIX_HEAP_HPP
@@ -0,0 +1,48 @@
+#include "ReachabilityIndex.hpp"
+#include "SCCAlgorithm.hpp"
+#include <vector>
+
+ReachabilityIndex::ReachabilityIndex(const Graph::Graph& graph) {
+    SCCAlgorithm::condense(graph, cond);
+    int count = cond.count;
+    words = (count + 63) / 64;
+    rows.assign((size_t)count * words, 0);
+    compSize.assign(count, 0);
+    for (size_t v = 0; v < cond.comp.size(); ++v) ++compSize[cond.comp[v]];
+
+    // Topological order of the DAG (Kahn).
+    std::vector<int> indegree(count, 0), order;
+    order.reserve(count);
+    for (size_t e = 0; e < cond.target.size(); ++e) ++indegree[cond.target[e]];
+    for (int c = 0; c < count; ++c)
+        if (indegree[c] == 0) order.push_back(c);
+    for (size_t head = 0; head < order.size(); ++head) {
+        int c = order[head];
+        for (int e = cond.offset[c]; e < cond.offset[c + 1]; ++e)
+            if (--indegree[cond.target[e]] == 0) order.push_back(cond.target[e]);
+    }
+
+    // Successors are complete before their predecessors in reverse topological order.
+    for (int i = count - 1; i >= 0; --i) {
+        int c = order[i];
+        Word* row = &rows[(size_t)c * words];
+        row[c / 64] |= 1ULL << (c % 64);
+        for (int e = cond.offset[c]; e < cond.offset[c + 1]; ++e) {
+            const Word* succ = &rows[(size_t)cond.target[e] * words];
+            for (int k = 0; k < words; ++k) row[k] |= succ[k];
+        }
+    }
+}
+
+long long ReachabilityIndex::reachableFrom(int v) const {
+    const Word* row = &rows[(size_t)cond.comp[v] * words];
+    long long total = 0;
+    for (int k = 0; k < words; ++k) {
+        Word w = row[k];
+        while (w) {
+            total += compSize[k * 64 + __builtin_ctzll(w)];
+            w &= w - 1;
+        }
+    }
+    return total;
+}
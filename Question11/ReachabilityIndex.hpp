@@ -0,0 +1,52 @@
+#ifndef REACHABILITY_INDEX_HPP
+#define REACHABILITY_INDEX_HPP
+
+#include "Graph.hpp"
+#include "Condensation.hpp"
+#include <vector>
+
+/**
+ * @brief Transitive closure of a graph, stored per SCC as bitset rows
+ * @details All vertices of an SCC reach the same set, so the closure is built on the
+ *          condensation DAG: in reverse topological order each component's row is its own bit
+ *          ORed, one 64-bit word at a time, with the rows of its successors. A query is then
+ *          one bit test. Memory is count^2 / 8 bytes for 'count' components.
+ */
+class ReachabilityIndex {
+public:
+    typedef unsigned long long Word;
+
+    /**
+     * @brief Build the index (SCCs, condensation, closure rows)
+     * @param graph source graph
+     */
+    explicit ReachabilityIndex(const Graph::Graph& graph);
+
+    /**
+     * @brief Can u reach v (every vertex reaches itself), O(1)
+     * @param u start vertex
+     * @param v target vertex
+     * @return true if there is a path from u to v
+     */
+    bool reaches(int u, int v) const {
+        int a = cond.comp[u], b = cond.comp[v];
+        return (rows[(size_t)a * words + b / 64] >> (b % 64)) & 1ULL;
+    }
+
+    const Condensation& condensation() const { return cond; }
+
+    /**
+     * @brief Number of vertices reachable from v (v included)
+     * @param v start vertex
+     * @return long long reachable vertex count
+     */
+    long long reachableFrom(int v) const;
+
+private:
+    Condensation cond;              ///< SCCs and their DAG
+    int words;                      ///< Words per row
+    std::vector<Word> rows;         ///< Closure row of each component
+    std::vector<int> compSize;      ///< Vertices in each component
+};
+
+#endif // REACHABILITY_INDEX_HPP
@@ -1,47 +1,187 @@
 #include "SCCAlgorithm.hpp"
 #include <string>
 #include <vector>
+#include <algorithm>
 
-void SCCAlgorithm::dfs(const Graph::Graph& g, int v, std::vector<bool>& visited, std::vector<int>& order) const {
-    visited[v] = true;
-    for (int u = 0; u < g.numOfVertices(); ++u) {
-        if (g.hasEdge(v, u) && !visited[u]) dfs(g, u, visited, order);
+namespace {
+
+// Append the decimal form of v without a temporary std::string.
+void appendInt(std::string& out, int v) {
+    char buf[12];
+    int len = 0;
+    unsigned int u = v < 0 ? 0u - (unsigned int)v : (unsigned int)v;
+    do { buf[len++] = (char)('0' + u % 10); u /= 10; } while (u);
+    if (v < 0) out += '-';
+    while (len) out += buf[--len];
+}
+
+// Tarjan with an explicit (vertex, next neighbor position) stack. comp gets ids in the
+// order components close, i.e. reverse topological order. If 'edges' is given, the
+// condensation edges of each component are collected as it closes: its members' other
+// neighbors all belong to components that already have an id.
+int tarjan(const Graph::Graph& g, std::vector<int>& comp, std::vector<std::pair<int, int>>* edges) {
+    int n = g.numOfVertices();
+    std::vector<int> index(n, -1), low(n, 0);
+    std::vector<bool> onStack(n, false);
+    std::vector<int> stack;                       // Tarjan's vertex stack
+    std::vector<std::pair<int, size_t>> frames;   // explicit DFS stack: (vertex, next neighbor position)
+    std::vector<int> lastEdge;                    // per component: last component that recorded an edge to it
+    if (edges) lastEdge.assign(n, -1);
+    comp.assign(n, -1);
+    int counter = 0, count = 0;
+
+    for (int root = 0; root < n; ++root) {
+        if (index[root] != -1) continue;
+        frames.push_back(std::make_pair(root, (size_t)0));
+        index[root] = low[root] = counter++;
+        stack.push_back(root);
+        onStack[root] = true;
+
+        while (!frames.empty()) {
+            int v = frames.back().first;
+            const std::vector<int>& adj = g.neighbors(v);
+            if (frames.back().second < adj.size()) {
+                int w = adj[frames.back().second++];
+                if (index[w] == -1) {
+                    index[w] = low[w] = counter++;
+                    stack.push_back(w);
+                    onStack[w] = true;
+                    frames.push_back(std::make_pair(w, (size_t)0));
+                } else if (onStack[w]) {
+                    low[v] = std::min(low[v], index[w]);
+                }
+                continue;
+            }
+
+            // All neighbors done: v closes a component if it is its root.
+            frames.pop_back();
+            if (low[v] == index[v]) {
+                size_t first = stack.size();
+                do { --first; } while (stack[first] != v);
+                for (size_t i = first; i < stack.size(); ++i) {
+                    comp[stack[i]] = count;
+                    onStack[stack[i]] = false;
+                }
+                if (edges) {
+                    for (size_t i = first; i < stack.size(); ++i) {
+                        const std::vector<int>& out = g.neighbors(stack[i]);
+                        for (size_t j = 0; j < out.size(); ++j) {
+                            int c = comp[out[j]];
+                            if (c != count && lastEdge[c] != count) {
+                                lastEdge[c] = count;
+                                edges->push_back(std::make_pair(count, c));
+                            }
+                        }
+                    }
+                }
+                stack.resize(first);
+                ++count;
+            }
+            if (!frames.empty()) {
+                int parent = frames.back().first;
+                low[parent] = std::min(low[parent], low[v]);
+            }
+        }
+    }
+    return count;
+}
+
+}
+
+int SCCAlgorithm::components(const Graph::Graph& g, std::vector<int>& comp) {
+    int count = tarjan(g, comp, nullptr);
+    // Renumber by smallest vertex so the labeling does not depend on the traversal.
+    relabelBySmallestVertex(comp, count);
+    return count;
+}
+
+void SCCAlgorithm::condense(const Graph::Graph& g, Condensation& out) {
+    std::vector<std::pair<int, int>> edges;
+    out.count = tarjan(g, out.comp, &edges);
+    std::vector<int> rename = relabelBySmallestVertex(out.comp, out.count);
+    for (size_t i = 0; i < edges.size(); ++i) {
+        edges[i].first = rename[edges[i].first];
+        edges[i].second = rename[edges[i].second];
     }
-    order.push_back(v);
+    out.setEdges(edges);
 }
 
-void SCCAlgorithm::dfsRev(const Graph::Graph& g, int v, std::vector<bool>& visited, std::vector<int>& component) const {
-    visited[v] = true;
-    component.push_back(v);
-    for (int u = 0; u < g.numOfVertices(); ++u) {
-        if (g.hasEdge(u, v) && !visited[u]) dfsRev(g, u, visited, component);
+std::vector<int> SCCAlgorithm::relabelBySmallestVertex(std::vector<int>& comp, int count) {
+    std::vector<int> rename(count, -1);
+    int next = 0;
+    for (size_t v = 0; v < comp.size(); ++v) {
+        if (rename[comp[v]] == -1) rename[comp[v]] = next++;
+        comp[v] = rename[comp[v]];
     }
+    return rename;
 }
 
 std::string SCCAlgorithm::run(const Graph::Graph& graph) {
-    int n = graph.numOfVertices();
-    std::vector<bool> visited(n, false);
-    std::vector<int> order;
-    for (int i = 0; i < n; ++i)
-        if (!visited[i]) dfs(graph, i, visited, order);
-    std::fill(visited.begin(), visited.end(), false);
-    int sccCount = 0;
-    std::vector<std::vector<int>> sccs;
-    for (int i = n - 1; i >= 0; --i) {
-        int v = order[i];
-        if (!visited[v]) {
-            std::vector<int> comp;
-            dfsRev(graph, v, visited, comp);
-            sccs.push_back(comp);
-            ++sccCount;
+    std::vector<int> comp;
+    int count = components(graph, comp);
+    return describe(comp, count);
+}
+
+std::string SCCAlgorithm::run(const Graph::Graph& graph, const AlgorithmParams& params) {
+    std::string format = params.getString("format", "list");
+    if (format == "list") return run(graph);
+    Condensation cond;
+    condense(graph, cond);
+    std::string result = describe(cond, format);
+    return result.empty() ? "Unknown format: " + format + " (use list, dag or binary)" : result;
+}
+
+std::string SCCAlgorithm::describe(const std::vector<int>& comp, int count) {
+    int n = (int)comp.size();
+    // Bucket the vertices by component (counting sort keeps them ascending).
+    std::vector<int> start(count + 1, 0), members(n);
+    for (int v = 0; v < n; ++v) ++start[comp[v] + 1];
+    for (int c = 0; c < count; ++c) start[c + 1] += start[c];
+    std::vector<int> pos(start.begin(), start.end() - 1);
+    for (int v = 0; v < n; ++v) members[pos[comp[v]]++] = v;
+
+    std::string result = "Strongly connected components:";
+    result.reserve(result.size() + 24 * (size_t)count + 8 * (size_t)n);
+    for (int c = 0; c < count; ++c) {
+        result += "\n       Component ";
+        appendInt(result, c + 1);
+        result += ": ";
+        for (int i = start[c]; i < start[c + 1]; ++i) {
+            if (i > start[c]) result += ", ";
+            appendInt(result, members[i]);
         }
     }
-    std::string result = "Strongly connected components:";
-    for (size_t i = 0; i < sccs.size(); ++i) {
-        result += "\n       Component " + std::to_string(i+1) + ": ";
-        for (size_t j = 0; j < sccs[i].size(); ++j) {
-            result += std::to_string(sccs[i][j]);
-            if (j+1 < sccs[i].size()) result += ", ";
+    return result;
+}
+
+std::string SCCAlgorithm::describe(const Condensation& cond, const std::string& format) {
+    if (format == "binary") return "Condensation (base64): " + cond.encode();
+    if (format != "dag") return "";
+
+    int n = (int)cond.comp.size();
+    std::vector<int> start(cond.count + 1, 0), members(n);
+    for (int v = 0; v < n; ++v) ++start[cond.comp[v] + 1];
+    for (int c = 0; c < cond.count; ++c) start[c + 1] += start[c];
+    std::vector<int> pos(start.begin(), start.end() - 1);
+    for (int v = 0; v < n; ++v) members[pos[cond.comp[v]]++] = v;
+
+    std::string result = "Condensation DAG: ";
+    appendInt(result, cond.count);
+    result += " components, ";
+    appendInt(result, (int)cond.target.size());
+    result += " edges";
+    result.reserve(result.size() + 32 * (size_t)cond.count + 8 * (size_t)(n + cond.target.size()));
+    for (int c = 0; c < cond.count; ++c) {
+        result += "\n       Component ";
+        appendInt(result, c + 1);
+        result += ": ";
+        for (int i = start[c]; i < start[c + 1]; ++i) {
+            if (i > start[c]) result += ", ";
+            appendInt(result, members[i]);
+        }
+        for (int i = cond.offset[c]; i < cond.offset[c + 1]; ++i) {
+            result += i > cond.offset[c] ? ", " : " -> ";
+            appendInt(result, cond.target[i] + 1);
         }
     }
     return result;
@@ -2,14 +2,31 @@
 #define SCC_ALGORITHM_HPP
 
 #include "GraphAlgorithm.hpp"
+#include "Condensation.hpp"
 #include <vector>
 
 class SCCAlgorithm : public GraphAlgorithm {
 public:
     std::string run(const Graph::Graph& graph) override;
-private:
-    void dfs(const Graph::Graph& g, int v, std::vector<bool>& visited, std::vector<int>& order) const;
-    void dfsRev(const Graph::Graph& g, int v, std::vector<bool>& visited, std::vector<int>& component) const;
+    // Options: format=list (default) | dag (components and their successors) | binary (Condensation::encode)
+    std::string run(const Graph::Graph& graph, const AlgorithmParams& params) override;
+
+    // Iterative Tarjan over the out-neighbor lists, O(V+E), no recursion.
+    // Fills comp[v] with the component of v and returns the number of components.
+    // Components are numbered by their smallest vertex (the component of vertex 0 is 0).
+    static int components(const Graph::Graph& graph, std::vector<int>& comp);
+
+    // Components plus the condensation DAG, collected in the same Tarjan pass.
+    static void condense(const Graph::Graph& graph, Condensation& out);
+
+    // Renumber components in order of their smallest vertex; returns the old -> new mapping.
+    static std::vector<int> relabelBySmallestVertex(std::vector<int>& comp, int count);
+
+    // Result text for a component labeling (shared with ParallelSCCAlgorithm).
+    static std::string describe(const std::vector<int>& comp, int count);
+
+    // Result text for the dag/binary formats; "" if the format is unknown.
+    static std::string describe(const Condensation& cond, const std::string& format);
 };
 
 #endif // SCC_ALGORITHM_HPP
@@ -0,0 +1,204 @@
+#include "SSSPAlgorithm.hpp"
+#include "RadixHeap.hpp"
+#include "ThreadPool.hpp"
+#include <algorithm>
+#include <atomic>
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+
+const long long SSSPAlgorithm::UNREACHABLE;
+
+namespace {
+
+// Any tight edge u->v (dist[u] + w == dist[v]) is a valid last step of a shortest path.
+void tightPredecessors(const Graph::Graph& g, int s, const std::vector<long long>& dist, std::vector<int>& pred) {
+    int n = g.numOfVertices();
+    pred.assign(n, -1);
+    for (int u = 0; u < n; ++u) {
+        if (dist[u] == SSSPAlgorithm::UNREACHABLE) continue;
+        const std::vector<int>& adj = g.neighbors(u);
+        for (size_t i = 0; i < adj.size(); ++i) {
+            int v = adj[i];
+            if (v != s && pred[v] == -1 && dist[u] + g.getEdgeWeight(u, v) == dist[v]) pred[v] = u;
+        }
+    }
+}
+
+}
+
+void SSSPAlgorithm::dijkstra(const Graph::Graph& graph, int s, std::vector<long long>& dist, std::vector<int>* pred,
+                             const std::vector<long long>* potential) {
+    int n = graph.numOfVertices();
+    dist.assign(n, UNREACHABLE);
+    if (pred) pred->assign(n, -1);
+    std::vector<bool> done(n, false);
+    RadixHeap heap;
+    dist[s] = 0;
+    heap.push(0, s);
+    while (!heap.empty()) {
+        int u = heap.pop().second;
+        if (done[u]) continue; // stale entry
+        done[u] = true;
+        const std::vector<int>& adj = graph.neighbors(u);
+        for (size_t i = 0; i < adj.size(); ++i) {
+            int v = adj[i];
+            long long w = graph.getEdgeWeight(u, v);
+            if (potential) w += (*potential)[u] - (*potential)[v];
+            long long nd = dist[u] + w;
+            if (dist[v] == UNREACHABLE || nd < dist[v]) {
+                dist[v] = nd;
+                if (pred) (*pred)[v] = u;
+                heap.push(nd, v);
+            }
+        }
+    }
+    if (potential) {
+        for (int v = 0; v < n; ++v)
+            if (dist[v] != UNREACHABLE) dist[v] += (*potential)[v] - (*potential)[s];
+    }
+}
+
+void SSSPAlgorithm::deltaStepping(const Graph::Graph& graph, int s, long long delta,
+                                  std::vector<long long>& dist, std::vector<int>* pred) {
+    int n = graph.numOfVertices();
+    if (delta <= 0) {
+        long long edges = 0, maxWeight = 1;
+        for (int u = 0; u < n; ++u) {
+            const std::vector<int>& adj = graph.neighbors(u);
+            edges += adj.size();
+            for (size_t i = 0; i < adj.size(); ++i)
+                maxWeight = std::max<long long>(maxWeight, graph.getEdgeWeight(u, adj[i]));
+        }
+        delta = std::max(1LL, edges ? maxWeight * n / edges : maxWeight);
+    }
+
+    const long long INF = (long long)(~0ULL >> 1);
+    std::vector<std::atomic<long long>> d(n);
+    for (int v = 0; v < n; ++v) d[v].store(INF);
+    d[s].store(0);
+
+    ThreadPool& pool = ThreadPool::shared();
+    std::map<long long, std::vector<int>> buckets; // bucket index -> vertices (may hold stale entries)
+    buckets[0].push_back(s);
+    std::mutex m;
+
+    // Relax the light or the heavy edges of 'from'; improved vertices move to their new bucket.
+    auto relax = [&](const std::vector<int>& from, bool light) {
+        std::vector<int> improved;
+        pool.parallelFor(0, (int)from.size(), [&](int lo, int hi) {
+            std::vector<int> local;
+            for (int i = lo; i < hi; ++i) {
+                int u = from[i];
+                long long du = d[u].load(std::memory_order_relaxed);
+                const std::vector<int>& adj = graph.neighbors(u);
+                for (size_t k = 0; k < adj.size(); ++k) {
+                    int v = adj[k];
+                    long long w = graph.getEdgeWeight(u, v);
+                    if ((w <= delta) != light) continue;
+                    long long nd = du + w;
+                    long long cur = d[v].load(std::memory_order_relaxed);
+                    while (nd < cur) {
+                        if (d[v].compare_exchange_weak(cur, nd)) { local.push_back(v); break; }
+                    }
+                }
+            }
+            if (local.empty()) return;
+            std::lock_guard<std::mutex> lk(m);
+            improved.insert(improved.end(), local.begin(), local.end());
+        });
+        for (size_t i = 0; i < improved.size(); ++i) {
+            int v = improved[i];
+            buckets[d[v].load() / delta].push_back(v);
+        }
+    };
+
+    std::vector<int> stamp(n, -1), settledStamp(n, -1);
+    int round = 0, phase = 0;
+    while (!buckets.empty()) {
+        long long b = buckets.begin()->first;
+        std::vector<int> settled;
+        // Light edges can refill bucket b, so keep going until it stays empty.
+        for (;;) {
+            std::map<long long, std::vector<int>>::iterator it = buckets.find(b);
+            if (it == buckets.end()) break;
+            std::vector<int> entries;
+            entries.swap(it->second);
+            buckets.erase(it);
+            std::vector<int> frontier;
+            for (size_t i = 0; i < entries.size(); ++i) {
+                int v = entries[i];
+                if (d[v].load() / delta != b || stamp[v] == round) continue;
+                stamp[v] = round;
+                frontier.push_back(v);
+                if (settledStamp[v] != phase) { settledStamp[v] = phase; settled.push_back(v); }
+            }
+            ++round;
+            relax(frontier, true);
+        }
+        relax(settled, false);
+        ++phase;
+    }
+
+    dist.assign(n, UNREACHABLE);
+    for (int v = 0; v < n; ++v)
+        if (d[v].load() != INF) dist[v] = d[v].load();
+    if (pred) tightPredecessors(graph, s, dist, *pred);
+}
+
+std::string SSSPAlgorithm::run(const Graph::Graph& graph) {
+    return run(graph, AlgorithmParams());
+}
+
+std::string SSSPAlgorithm::run(const Graph::Graph& graph, const AlgorithmParams& params) {
+    int n = graph.numOfVertices();
+    int s = params.getInt("s", 0);
+    if (s < 0 || s >= n)
+        return "Invalid source: vertices must be between 0 and " + std::to_string(n - 1);
+
+    long long edges = 0;
+    for (int u = 0; u < n; ++u) {
+        const std::vector<int>& adj = graph.neighbors(u);
+        edges += adj.size();
+        for (size_t i = 0; i < adj.size(); ++i)
+            if (graph.getEdgeWeight(u, adj[i]) < 0) return "Negative edge weights are not supported";
+    }
+
+    // Delta-stepping only pays for its rounds on large graphs with threads to spare.
+    std::string mode = params.getString("mode", "auto");
+    if (mode == "auto") mode = (edges >= 100000 && ThreadPool::shared().size() > 1) ? "delta" : "dijkstra";
+    bool wantPred = params.getBool("pred", false);
+    std::vector<long long> dist;
+    std::vector<int> pred;
+    if (mode == "dijkstra")
+        dijkstra(graph, s, dist, wantPred ? &pred : nullptr);
+    else if (mode == "delta")
+        deltaStepping(graph, s, params.getInt("delta", 0), dist, wantPred ? &pred : nullptr);
+    else
+        return "Unknown mode: " + mode + " (use auto, dijkstra or delta)";
+
+    int reached = 0;
+    std::string list;
+    list.reserve((size_t)n * 4);
+    for (int v = 0; v < n; ++v) {
+        if (v) list += ", ";
+        if (dist[v] == UNREACHABLE) {
+            list += "-";
+            continue;
+        }
+        ++reached;
+        list += std::to_string(dist[v]);
+    }
+    std::string result = "Shortest distances from " + std::to_string(s) + " (" + mode + "): " +
+                         std::to_string(reached) + " of " + std::to_string(n) + " vertices reached" +
+                         "\n       Distances: " + list;
+    if (wantPred) {
+        result += "\n       Predecessors: ";
+        for (int v = 0; v < n; ++v) {
+            if (v) result += ", ";
+            result += pred[v] == -1 ? "-" : std::to_string(pred[v]);
+        }
+    }
+    return result;
+}
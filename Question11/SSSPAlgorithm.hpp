@@ -0,0 +1,36 @@
+#ifndef SSSP_ALGORITHM_HPP
+#define SSSP_ALGORITHM_HPP
+
+#include "GraphAlgorithm.hpp"
+#include <vector>
+
+/**
+ * @brief Single-source shortest paths over the (non-negative) edge weights
+ * @details Dijkstra pops vertices from a RadixHeap. Delta-stepping relaxes whole distance
+ *          buckets of width delta at once: light edges (w <= delta) repeatedly until the
+ *          bucket settles, then heavy edges once, each relaxation round spread over the shared
+ *          ThreadPool with atomic minimum updates of the distances.
+ */
+class SSSPAlgorithm : public GraphAlgorithm {
+public:
+    static const long long UNREACHABLE = -1;
+
+    std::string run(const Graph::Graph& graph) override;
+    // Options: s=<source> (default 0), mode=auto|dijkstra|delta, delta=<bucket width>,
+    //          pred=1 also reports the predecessor of every vertex
+    std::string run(const Graph::Graph& graph, const AlgorithmParams& params) override;
+
+    // Dijkstra with a radix heap; dist[v] = UNREACHABLE if v cannot be reached.
+    // pred (if not null) receives the previous vertex on a shortest path, -1 for s and unreachable.
+    // With 'potential' the search runs on w(u,v) + potential[u] - potential[v], which must be
+    // non-negative (Johnson reweighting); dist is still reported in the original weights.
+    static void dijkstra(const Graph::Graph& graph, int s, std::vector<long long>& dist, std::vector<int>* pred,
+                         const std::vector<long long>* potential = nullptr);
+
+    // Parallel delta-stepping, same results as dijkstra (pred may pick another shortest path).
+    // delta <= 0 picks max weight / average degree.
+    static void deltaStepping(const Graph::Graph& graph, int s, long long delta,
+                              std::vector<long long>& dist, std::vector<int>* pred);
+};
+
+#endif // SSSP_ALGORITHM_HPP
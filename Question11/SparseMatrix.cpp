@@ -0,0 +1,27 @@
+#include "SparseMatrix.hpp"
+#include "ThreadPool.hpp"
+#include <vector>
+
+SparseMatrix::SparseMatrix(int numRows, int numCols, const std::vector<Entry>& entries)
+    : rows(numRows), cols(numCols), offset(numRows + 1, 0), col(entries.size()), value(entries.size()) {
+    for (size_t i = 0; i < entries.size(); ++i) ++offset[entries[i].row + 1];
+    for (int r = 0; r < rows; ++r) offset[r + 1] += offset[r];
+    std::vector<int> pos(offset.begin(), offset.end() - 1);
+    for (size_t i = 0; i < entries.size(); ++i) {
+        int p = pos[entries[i].row]++;
+        col[p] = entries[i].col;
+        value[p] = entries[i].value;
+    }
+}
+
+void SparseMatrix::multiply(const std::vector<double>& x, std::vector<double>& y) const {
+    y.resize(rows);
+    // Chunks of ~1024 rows keep the per-chunk overhead small next to the row sums.
+    ThreadPool::shared().parallelFor(0, rows, [&](int lo, int hi) {
+        for (int r = lo; r < hi; ++r) {
+            double sum = 0;
+            for (int e = offset[r]; e < offset[r + 1]; ++e) sum += value[e] * x[col[e]];
+            y[r] = sum;
+        }
+    }, 1024);
+}
@@ -0,0 +1,50 @@
+#ifndef SPARSE_MATRIX_HPP
+#define SPARSE_MATRIX_HPP
+
+#include <vector>
+
+/**
+ * @brief Sparse matrix in CSR form with a parallel matrix-vector product
+ * @details Row i holds its entries col[offset[i]] .. col[offset[i+1]-1] with their values.
+ *          multiply() is pull-based: each y[i] is gathered from x by one thread, so rows are
+ *          split across the shared ThreadPool without any atomics, and the result does not
+ *          depend on the thread count. Iterative algorithms (PageRank and friends) share it.
+ */
+class SparseMatrix {
+public:
+    struct Entry {
+        int row;
+        int col;
+        double value;
+    };
+
+    SparseMatrix() : rows(0), cols(0) {}
+
+    /**
+     * @brief Build from (row, col, value) entries in O(rows + entries); entries may come in any order
+     * @param numRows number of rows
+     * @param numCols number of columns
+     * @param entries the non-zero entries (duplicates are kept and add up in products)
+     */
+    SparseMatrix(int numRows, int numCols, const std::vector<Entry>& entries);
+
+    int numOfRows() const { return rows; }
+    int numOfCols() const { return cols; }
+    int numOfEntries() const { return (int)col.size(); }
+
+    /**
+     * @brief y = A x, parallel over row ranges
+     * @param x input vector, size numOfCols()
+     * @param y output vector, resized to numOfRows()
+     */
+    void multiply(const std::vector<double>& x, std::vector<double>& y) const;
+
+private:
+    int rows;                       ///< Number of rows
+    int cols;                       ///< Number of columns
+    std::vector<int> offset;        ///< Row offsets, size rows+1
+    std::vector<int> col;           ///< Column of each entry
+    std::vector<double> value;      ///< Value of each entry
+};
+
+#endif // SPARSE_MATRIX_HPP
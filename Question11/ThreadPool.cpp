@@ -0,0 +1,108 @@
+#include "ThreadPool.hpp"
+#include <atomic>
+#include <memory>
+#include <algorithm>
+
+namespace {
+
+// State of one parallelFor call, shared by the caller and the helper tasks.
+// Helpers may start after the loop is over; they then find no chunk left and return.
+struct ForState {
+    std::atomic<int> next;      // first index of the next unclaimed chunk
+    std::atomic<int> finished;  // number of chunks fully processed
+    int end;
+    int grain;
+    int chunks;
+    const std::function<void(int, int)>* body;
+    std::mutex m;
+    std::condition_variable cv;
+};
+
+// Claim and run chunks until the range is exhausted.
+void runChunks(ForState& st) {
+    for (;;) {
+        int lo = st.next.fetch_add(st.grain);
+        if (lo >= st.end) return;
+        int hi = std::min(st.end, lo + st.grain);
+        (*st.body)(lo, hi);
+        if (st.finished.fetch_add(1) + 1 == st.chunks) {
+            std::lock_guard<std::mutex> lk(st.m);
+            st.cv.notify_all();
+        }
+    }
+}
+
+}
+
+ThreadPool::ThreadPool(unsigned numThreads) : stopping(false) {
+    if (numThreads == 0) numThreads = std::thread::hardware_concurrency();
+    if (numThreads == 0) numThreads = 2;
+    // The thread calling parallelFor works too, so one worker less is enough.
+    for (unsigned i = 0; i + 1 < numThreads; ++i)
+        workers.emplace_back(&ThreadPool::workerLoop, this);
+}
+
+ThreadPool::~ThreadPool() {
+    {
+        std::lock_guard<std::mutex> lk(m);
+        stopping = true;
+    }
+    cv.notify_all();
+    for (size_t i = 0; i < workers.size(); ++i) workers[i].join();
+}
+
+void ThreadPool::workerLoop() {
+    for (;;) {
+        std::function<void()> task;
+        {
+            std::unique_lock<std::mutex> lk(m);
+            cv.wait(lk, [&]{ return stopping || !tasks.empty(); });
+            if (tasks.empty()) return; // stopping and nothing left
+            task = std::move(tasks.front());
+            tasks.pop();
+        }
+        task();
+    }
+}
+
+void ThreadPool::submit(std::function<void()> task) {
+    {
+        std::lock_guard<std::mutex> lk(m);
+        tasks.push(std::move(task));
+    }
+    cv.notify_one();
+}
+
+void ThreadPool::parallelFor(int begin, int end, const std::function<void(int, int)>& body, int grain) {
+    if (begin >= end) return;
+    int total = end - begin;
+    int threads = (int)size();
+    if (grain <= 0) grain = std::max(1, total / (threads * 4));
+    if (threads == 1 || total <= grain) { body(begin, end); return; }
+
+    std::shared_ptr<ForState> st = std::make_shared<ForState>();
+    st->next.store(begin);
+    st->finished.store(0);
+    st->end = end;
+    st->grain = grain;
+    st->chunks = (total + grain - 1) / grain;
+    st->body = &body;
+
+    int helpers = std::min((int)workers.size(), st->chunks - 1);
+    for (int i = 0; i < helpers; ++i)
+        submit([st]{ runChunks(*st); });
+
+    runChunks(*st);
+
+    std::unique_lock<std::mutex> lk(st->m);
+    st->cv.wait(lk, [&]{ return st->finished.load() == st->chunks; });
+}
+
+unsigned ThreadPool::size() const {
+    return (unsigned)workers.size() + 1;
+}
+
+ThreadPool& ThreadPool::shared() {
+    static ThreadPool pool;
+    return pool;
+}
@@ -0,0 +1,71 @@
+#ifndef THREAD_POOL_HPP
+#define THREAD_POOL_HPP
+
+#include <vector>
+#include <queue>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+
+/**
+ * @brief Fixed-size pool of worker threads shared by the parallel algorithm strategies
+ * @details Tasks are plain std::function<void()> objects taken from a single FIFO queue.
+ *          parallelFor() splits an index range into chunks that workers claim dynamically;
+ *          the calling thread takes part in the work, so a parallelFor issued from inside
+ *          a pool task (nested parallelism) can never deadlock waiting for a free worker.
+ */
+class ThreadPool {
+public:
+    /**
+     * @brief Start the worker threads
+     * @param numThreads number of workers (0 means std::thread::hardware_concurrency())
+     */
+    explicit ThreadPool(unsigned numThreads = 0);
+
+    /**
+     * @brief Stop the workers - tasks still waiting in the queue are drained first
+     */
+    ~ThreadPool();
+
+    /**
+     * @brief Enqueue a task to be run by one of the workers
+     * @param task the work to run
+     */
+    void submit(std::function<void()> task);
+
+    /**
+     * @brief Run body(lo, hi) over [begin, end) split into chunks and wait for all of them
+     * @param begin first index
+     * @param end one past the last index
+     * @param body called once per chunk with its half-open sub-range
+     * @param grain chunk size (0 picks one so that every thread gets a few chunks)
+     */
+    void parallelFor(int begin, int end, const std::function<void(int, int)>& body, int grain = 0);
+
+    /**
+     * @brief Number of threads that can work on a parallelFor (workers + the caller)
+     * @return unsigned thread count
+     */
+    unsigned size() const;
+
+    /**
+     * @brief Process-wide pool used by the algorithm strategies
+     * @return ThreadPool& the shared pool (created on first use)
+     */
+    static ThreadPool& shared();
+
+private:
+    void workerLoop();
+
+    std::vector<std::thread> workers;           ///< Worker threads
+    std::queue<std::function<void()>> tasks;    ///< Pending tasks
+    std::mutex m;                               ///< Protects 'tasks' and 'stopping'
+    std::condition_variable cv;                 ///< Wakes workers when a task arrives
+    bool stopping;                              ///< Set by the destructor
+
+    ThreadPool(const ThreadPool&);
+    ThreadPool& operator=(const ThreadPool&);
+};
+
+#endif // THREAD_POOL_HPP
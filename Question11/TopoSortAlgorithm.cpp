@@ -0,0 +1,124 @@
+#include "TopoSortAlgorithm.hpp"
+#include <algorithm>
+#include <climits>
+#include <string>
+#include <vector>
+
+bool TopoSortAlgorithm::topologicalOrder(const Graph::Graph& graph, std::vector<int>& order, std::vector<int>* cycle) {
+    int n = graph.numOfVertices();
+    std::vector<int> inDegree(n, 0);
+    for (int u = 0; u < n; ++u) {
+        const std::vector<int>& adj = graph.neighbors(u);
+        for (size_t i = 0; i < adj.size(); ++i) ++inDegree[adj[i]];
+    }
+
+    // 'order' doubles as the queue: vertices are appended once their in-degree drops to 0.
+    order.clear();
+    for (int v = 0; v < n; ++v)
+        if (inDegree[v] == 0) order.push_back(v);
+    for (size_t head = 0; head < order.size(); ++head) {
+        const std::vector<int>& adj = graph.neighbors(order[head]);
+        for (size_t i = 0; i < adj.size(); ++i)
+            if (--inDegree[adj[i]] == 0) order.push_back(adj[i]);
+    }
+    if ((int)order.size() == n) return true;
+    if (!cycle) return false;
+
+    // Vertices still holding in-degree each have a predecessor among them: walk backwards
+    // until a vertex repeats.
+    std::vector<int> pred(n, -1);
+    for (int u = 0; u < n; ++u) {
+        if (inDegree[u] == 0) continue;
+        const std::vector<int>& adj = graph.neighbors(u);
+        for (size_t i = 0; i < adj.size(); ++i)
+            if (inDegree[adj[i]] > 0) pred[adj[i]] = u;
+    }
+    std::vector<int> step(n, -1);
+    int v = 0;
+    while (inDegree[v] == 0) ++v;
+    std::vector<int> walk;
+    while (step[v] == -1) {
+        step[v] = (int)walk.size();
+        walk.push_back(v);
+        v = pred[v];
+    }
+    // The walk went against the edges; the loop read backwards follows them.
+    cycle->assign(walk.rbegin(), walk.rend() - step[v]);
+    std::rotate(cycle->begin(), std::min_element(cycle->begin(), cycle->end()), cycle->end());
+    return false;
+}
+
+void TopoSortAlgorithm::dagPaths(const Graph::Graph& graph, const std::vector<int>& order, int s, bool longest,
+                                 std::vector<long long>& dist, std::vector<int>* pred) {
+    int n = graph.numOfVertices();
+    long long unreached = longest ? LLONG_MIN : LLONG_MAX;
+    dist.assign(n, unreached);
+    if (pred) pred->assign(n, -1);
+    dist[s] = 0;
+
+    // Everything before s in the order is unreachable from it.
+    size_t i = std::find(order.begin(), order.end(), s) - order.begin();
+    for (; i < order.size(); ++i) {
+        int u = order[i];
+        if (dist[u] == unreached) continue;
+        const std::vector<int>& adj = graph.neighbors(u);
+        for (size_t k = 0; k < adj.size(); ++k) {
+            int v = adj[k];
+            long long d = dist[u] + graph.getEdgeWeight(u, v);
+            if (longest ? d <= dist[v] : d >= dist[v]) continue;
+            dist[v] = d;
+            if (pred) (*pred)[v] = u;
+        }
+    }
+}
+
+std::string TopoSortAlgorithm::run(const Graph::Graph& graph) {
+    return run(graph, AlgorithmParams());
+}
+
+std::string TopoSortAlgorithm::run(const Graph::Graph& graph, const AlgorithmParams& params) {
+    int n = graph.numOfVertices();
+    if (!graph.isDirected()) return "Topological order needs a directed graph";
+    int s = params.getInt("s", 0), t = params.getInt("t", -1);
+    if (s < 0 || s >= n || t < -1 || t >= n)
+        return "Invalid source or target: vertices must be between 0 and " + std::to_string(n - 1);
+
+    std::vector<int> order, cycle;
+    if (!topologicalOrder(graph, order, &cycle)) {
+        std::string result = "Not a DAG, cycle: ";
+        for (size_t i = 0; i < cycle.size(); ++i) result += std::to_string(cycle[i]) + " -> ";
+        return result + std::to_string(cycle[0]);
+    }
+
+    std::string result = "Topological order: ";
+    for (int i = 0; i < n; ++i) {
+        if (i) result += ", ";
+        result += std::to_string(order[i]);
+    }
+    for (int pass = 0; pass < 2; ++pass) {
+        bool longest = pass == 1;
+        std::string kind = longest ? "Longest" : "Shortest";
+        long long unreached = longest ? LLONG_MIN : LLONG_MAX;
+        std::vector<long long> dist;
+        std::vector<int> pred;
+        dagPaths(graph, order, s, longest, dist, &pred);
+        result += "\n       " + kind + " paths from " + std::to_string(s) + ": ";
+        for (int v = 0; v < n; ++v) {
+            if (v) result += ", ";
+            result += dist[v] == unreached ? "-" : std::to_string(dist[v]);
+        }
+        if (t == -1) continue;
+        result += "\n       " + kind + " path to " + std::to_string(t) + ": ";
+        if (dist[t] == unreached) {
+            result += "none";
+            continue;
+        }
+        std::vector<int> path;
+        for (int v = t; v != -1; v = pred[v]) path.push_back(v);
+        for (size_t i = path.size(); i-- > 0;) {
+            result += std::to_string(path[i]);
+            if (i) result += " -> ";
+        }
+    }
+    return result;
+}
@@ -0,0 +1,46 @@
+#ifndef TOPO_SORT_ALGORITHM_HPP
+#define TOPO_SORT_ALGORITHM_HPP
+
+#include "GraphAlgorithm.hpp"
+#include <vector>
+
+/**
+ * @brief Topological order of a directed graph, with DAG shortest and longest paths
+ * @details Kahn's algorithm repeatedly takes a vertex with no unprocessed in-edges. If it
+ *          stops early, every vertex left has a predecessor that is also left, so walking
+ *          backwards from any of them must revisit a vertex: that loop is reported as the cycle.
+ *          On a DAG, relaxing the out-edges of each vertex in topological order settles
+ *          single-source shortest and longest paths in O(V+E), negative weights included.
+ */
+class TopoSortAlgorithm : public GraphAlgorithm {
+public:
+    std::string run(const Graph::Graph& graph) override;
+    // Options: s=<source> for the path lengths (default 0),
+    //          t=<target> also lists the vertices of the shortest and longest path to it
+    std::string run(const Graph::Graph& graph, const AlgorithmParams& params) override;
+
+    /**
+     * @brief Topological order by Kahn's algorithm (sources taken in ascending vertex order)
+     * @param graph directed graph
+     * @param order filled with the vertices, every edge pointing forward
+     * @param cycle if not null and the graph has a cycle, receives one (v0, v1, ..., vk with
+     *        edges v0 -> v1 -> ... -> vk -> v0)
+     * @return true for a DAG, false if the graph has a cycle ('order' is then incomplete)
+     */
+    static bool topologicalOrder(const Graph::Graph& graph, std::vector<int>& order, std::vector<int>* cycle = nullptr);
+
+    /**
+     * @brief Path lengths from s along a topological order
+     * @param graph directed acyclic graph
+     * @param order its topological order
+     * @param s source vertex
+     * @param longest find longest instead of shortest paths
+     * @param dist filled with the path weights; vertices s cannot reach get LLONG_MAX for
+     *        shortest and LLONG_MIN for longest paths
+     * @param pred if not null, receives the previous vertex on each path (-1 for s and unreachable)
+     */
+    static void dagPaths(const Graph::Graph& graph, const std::vector<int>& order, int s, bool longest,
+                         std::vector<long long>& dist, std::vector<int>* pred = nullptr);
+};
+
+#endif // TOPO_SORT_ALGORITHM_HPP
@@ -0,0 +1,32 @@
+#ifndef TRIANGLE_ALGORITHM_HPP
+#define TRIANGLE_ALGORITHM_HPP
+
+#include "GraphAlgorithm.hpp"
+#include <vector>
+
+/**
+ * @brief Triangle counting and local clustering coefficients
+ * @details Edges are oriented from lower to higher (degree, id) rank, which leaves every vertex
+ *          at most O(sqrt(E)) out-neighbors and finds each triangle exactly once, from its
+ *          lowest-ranked corner. Out-lists are sorted by rank, so a triangle u < v < w is an
+ *          element shared by out(u) and out(v): a linear merge, or galloping search when one
+ *          list is much longer. Start vertices are spread over the shared ThreadPool.
+ *          Adjacency follows BitGraph (u < v adjacent when hasEdge(u, v)), so the count equals
+ *          the number of 3-cliques reported by the clique strategies.
+ */
+class TriangleAlgorithm : public GraphAlgorithm {
+public:
+    std::string run(const Graph::Graph& graph) override;
+    // Options: clustering=1 also reports per-vertex clustering coefficients
+    std::string run(const Graph::Graph& graph, const AlgorithmParams& params) override;
+
+    /**
+     * @brief Count triangles
+     * @param graph source graph
+     * @param perVertex if not null, receives the number of triangles through each vertex
+     * @return long long number of triangles
+     */
+    static long long countTriangles(const Graph::Graph& graph, std::vector<long long>* perVertex);
+};
+
+#endif // TRIANGLE_ALGORITHM_HPP
@@ -0,0 +1,32 @@
+#include "UnionFind.hpp"
+#include <utility>
+
+UnionFind::UnionFind(int numElements)
+    : parent(numElements), rank(numElements, 0), setSize(numElements, 1), sets(numElements) {
+    for (int v = 0; v < numElements; ++v) parent[v] = v;
+}
+
+int UnionFind::find(int v) {
+    while (parent[v] != v) {
+        parent[v] = parent[parent[v]];
+        v = parent[v];
+    }
+    return v;
+}
+
+int UnionFind::root(int v) const {
+    while (parent[v] != v) v = parent[v];
+    return v;
+}
+
+bool UnionFind::unite(int a, int b) {
+    a = find(a);
+    b = find(b);
+    if (a == b) return false;
+    if (rank[a] < rank[b]) std::swap(a, b);
+    parent[b] = a;
+    setSize[a] += setSize[b];
+    if (rank[a] == rank[b]) ++rank[a];
+    --sets;
+    return true;
+}
@@ -0,0 +1,61 @@
+#ifndef UNION_FIND_HPP
+#define UNION_FIND_HPP
+
+#include <vector>
+
+/**
+ * @brief Disjoint sets with union by rank and path halving
+ * @details Merging is cheap enough to run online, one unite() per edge as it arrives, so the
+ *          number of components and their sizes are known as soon as the last edge is in.
+ *          Union by rank keeps every tree O(log n) deep, which makes the read-only root()
+ *          usable from const code without compressing paths.
+ */
+class UnionFind {
+public:
+    /**
+     * @brief Start with every element in a set of its own
+     * @param numElements number of elements
+     */
+    explicit UnionFind(int numElements = 0);
+
+    /**
+     * @brief Representative of the set of v, halving the path on the way up
+     * @param v element
+     * @return int root of v's set
+     */
+    int find(int v);
+
+    /**
+     * @brief Representative of the set of v without modifying the structure, O(log n)
+     * @param v element
+     * @return int root of v's set
+     */
+    int root(int v) const;
+
+    /**
+     * @brief Merge the sets of a and b
+     * @param a first element
+     * @param b second element
+     * @return true if they were in different sets
+     */
+    bool unite(int a, int b);
+
+    int numOfElements() const { return (int)parent.size(); }
+    int count() const { return sets; }
+    bool isRoot(int v) const { return parent[v] == v; }
+
+    /**
+     * @brief Number of elements in the set of v
+     * @param v element
+     * @return int set size
+     */
+    int size(int v) const { return setSize[root(v)]; }
+
+private:
+    std::vector<int> parent;    ///< Parent in the tree, itself for roots
+    std::vector<int> rank;      ///< Upper bound on tree height (roots only)
+    std::vector<int> setSize;   ///< Elements in the set (roots only)
+    int sets;                   ///< Number of disjoint sets
+};
+
+#endif // UNION_FIND_HPP
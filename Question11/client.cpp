@@ -53,28 +53,39 @@ int main(int argc, char *argv[])
 	// getopt setup
 	int opt;
 	int mode = -1; // -1=unset, 0=manual, 1=random
-	int vertices = 0, edges = 0, max_weight = 10;
+	int vertices = 0, edges = 0, max_weight = 10, max_cost = 0;
 	bool error = false;
-	while ((opt = getopt(argc, argv, "rmn:e:w:s:")) != -1) {
+	std::vector<std::string> requests; // "-a" algorithm requests, e.g. "maxflow s=2 t=7"
+	int directed = 1; // directed unless -u is given
+	while ((opt = getopt(argc, argv, "rmun:e:w:c:s:a:")) != -1) {
 		switch (opt) {
 			case 'r': mode = 1; break;
 			case 'm': mode = 0; break;
+			case 'u': directed = 0; break;
 			case 'n': vertices = atoi(optarg); break;
 			case 'e': edges = atoi(optarg); break;
 			case 'w': max_weight = atoi(optarg); break;
+			case 'c': max_cost = atoi(optarg); break;
 			case 's': seed = atoi(optarg); break;
+			case 'a': requests.push_back(optarg); break;
 			default: error = true; break;
 		}
 	}
 	if (mode == -1 || vertices <= 0 || error || (mode == 1 && edges <= 0)) {
 		fprintf(stderr,
-			"Usage: %s [-r|-m] -n <vertices> -e <edges> [-w <max_weight>] [-s <seed>]\n"
+			"Usage: %s [-r|-m] [-u] -n <vertices> -e <edges> [-w <max_weight>] [-c <max_cost>] [-s <seed>] [-a \"<algorithm> key=value ...\"]...\n"
 			"  -r : random graph mode (requires -n, -e, -w) [-s <seed>]\n"
 			"  -m : manual graph mode (requires -n, -e)\n"
+			"  -u : undirected graph (default is directed)\n"
 			"  -n : number of vertices (>0)\n"
 			"  -e : number of edges (>0)\n"
 			"  -w : max edge weight (random mode, default 10)\n"
-			"  -s : random seed (optional, random mode only, default is current time)\n",
+			"  -c : edges also carry a cost (random mode: max cost, default 0 = no costs;\n"
+			"       manual mode: any value > 0 reads \"u v w c\" per edge)\n"
+			"  -s : random seed (optional, random mode only, default is current time)\n"
+			"  -a : algorithm request, repeatable. Options for mst/maxflow/scc/clique\n"
+			"       configure that stage (e.g. \"maxflow s=2 t=7\"); any other factory\n"
+			"       name runs as an extra algorithm (e.g. \"pushrelabel s=1 t=3\")\n",
 			argv[0]);
 		return 1;
 	}
@@ -112,16 +123,23 @@ int main(int argc, char *argv[])
 	printf("client: connected to %s\n", s);
 	freeaddrinfo(servinfo);
 
-	// Build graph (always directed & weighted)
-	std::vector<std::tuple<int,int,int>> edgeList;
+	// Build graph (weighted, directed unless -u)
+	std::vector<std::tuple<int,int,int,int>> edgeList; // u, v, weight, cost
 	if (mode == 1) {
-		// Random graph: generate 'edges' random directed edges with random weights
-		if (edges <= 0 || edges > vertices * (vertices - 1)) {
+		// Random graph: generate 'edges' random edges with random weights
+		if (directed && (edges <= 0 || edges > vertices * (vertices - 1))) {
 			fprintf(stderr, "Error: Number of edges must be in [1, V*(V-1)] for directed graph without self-loops.\n");
 			return 1;
 		}
+		if (!directed && (edges <= 0 || edges > vertices * (vertices - 1) / 2)) {
+			fprintf(stderr, "Error: Number of edges must be in [1, V*(V-1)/2] for undirected graph without self-loops.\n");
+			return 1;
+		}
 		std::mt19937 gen(seed);
 		std::uniform_int_distribution<> weight_dist(1, max_weight);
+		// Costs come from their own generator, so -c keeps the same edges for a given seed
+		std::mt19937 cost_gen(seed + 1);
+		std::uniform_int_distribution<> cost_dist(1, max_cost > 0 ? max_cost : 1);
 		std::set<std::pair<int,int>> used_edges;
 		int generated = 0;
 		while (generated < edges) {
@@ -129,8 +147,10 @@ int main(int argc, char *argv[])
 			int v = gen() % vertices;
 			if (u == v) continue; // No self-loops
 			if (used_edges.count({u, v})) continue; // No duplicate edges
+			if (!directed && used_edges.count({v, u})) continue; // {u,v} is the same undirected edge
 			int w = weight_dist(gen);
-			edgeList.push_back(std::make_tuple(u, v, w));
+			int c = max_cost > 0 ? cost_dist(cost_gen) : 0;
+			edgeList.push_back(std::make_tuple(u, v, w, c));
 			used_edges.insert({u, v});
 			++generated;
 		}
@@ -145,9 +165,10 @@ int main(int argc, char *argv[])
 			return 1;
 		}
 		for (int i = 0; i < edges; ++i) {
-			int u, v, w;
-			printf("Enter edge %d (u v w): ", i+1);
-			if (scanf("%d %d %d", &u, &v, &w) != 3 || u < 0 || u >= vertices || v < 0 || v >= vertices || w <= 0) {
+			int u, v, w, c = 0;
+			printf(max_cost > 0 ? "Enter edge %d (u v w c): " : "Enter edge %d (u v w): ", i+1);
+			if (scanf("%d %d %d", &u, &v, &w) != 3 || (max_cost > 0 && scanf("%d", &c) != 1) ||
+				u < 0 || u >= vertices || v < 0 || v >= vertices || w <= 0) {
 				fprintf(stderr, "Error: Invalid edge or weight.\n");
 				return 1;
 			}
@@ -158,22 +179,29 @@ int main(int argc, char *argv[])
 			bool duplicate = false;
 			for (auto& e : edgeList) {
 				if (std::get<0>(e) == u && std::get<1>(e) == v) duplicate = true;
+				if (!directed && std::get<0>(e) == v && std::get<1>(e) == u) duplicate = true;
 			}
 			if (duplicate) {
 				fprintf(stderr, "Warning: Duplicate edge (%d,%d) not allowed.\n", u, v);
 				return 1;
 			}
-			edgeList.push_back(std::make_tuple(u, v, w));
+			edgeList.push_back(std::make_tuple(u, v, w, c));
 		}
 	}
 
 	// Build one message with all parameters and edges
 	std::ostringstream oss;
 	oss << seed << "\n";
-	int directed = 1; // Always directed graph
-	oss << directed << "\n" << vertices << "\n" << edges << "\n";
+	oss << directed << "\n" << vertices << "\n" << edges;
+	if (!requests.empty()) oss << " " << requests.size();
+	oss << "\n";
 	for (auto& e : edgeList) {
-	    oss << std::get<0>(e) << " " << std::get<1>(e) << " " << std::get<2>(e) << "\n";
+	    oss << std::get<0>(e) << " " << std::get<1>(e) << " " << std::get<2>(e);
+	    if (max_cost > 0) oss << " " << std::get<3>(e);
+	    oss << "\n";
+	}
+	for (auto& r : requests) {
+	    oss << r << "\n";
 	}
 	std::string graphData = oss.str();
 	if (send(sockfd, graphData.c_str(), graphData.size(), 0) == -1) {
@@ -181,9 +209,13 @@ int main(int argc, char *argv[])
 		return 1;
 	}
 
-	// Receive result from server
-	char result[1024] = {0};
-	recv(sockfd, result, sizeof(result), 0);
+	// Receive result from server (the server closes the connection after the reply)
+	std::string result;
+	char buf[MAXDATASIZE];
+	int numbytes;
+	while ((numbytes = recv(sockfd, buf, sizeof(buf), 0)) > 0) {
+		result.append(buf, numbytes);
+	}
 	std::cout << "Result from server: \n" << result << std::endl;
 	// Finish
 	close(sockfd);
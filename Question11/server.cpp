@@ -27,12 +27,15 @@
 #include <queue>
 #include <memory>
 #include <atomic>
+#include <map>
 
 #include "Graph.hpp"
 #include "MSTAlgorithm.hpp"
 #include "MaxFlowAlgorithm.hpp"
 #include "SCCAlgorithm.hpp"
 #include "CliqueCountAlgorithm.hpp"
+#include "GraphAlgorithmFactory.hpp"
+#include "AlgorithmParams.hpp"
 
 #define PORT "3490"
 #define BACKLOG 10
@@ -70,7 +73,8 @@ static void *get_in_addr(struct sockaddr *sa) {
     return &(((struct sockaddr_in6*)sa)->sin6_addr);
 }
 
-// Read full message: 4 headers (seed, directed, vertices, edges) + <edges> lines: "u v w"
+// Read full message: 4 headers (seed, directed, vertices, "edges [requests]") + <edges> lines: "u v w [cost]"
+// + <requests> lines: "<algorithm> key=value ..." (the requests count is optional, default 0)
 static bool recv_full_message(int fd, std::string& out) {
     out.clear();
     char buf[4096];
@@ -89,9 +93,11 @@ static bool recv_full_message(int fd, std::string& out) {
             std::getline(peek,tmp); // seed
             std::getline(peek,tmp); // directed
             std::getline(peek,tmp); // vertices
-            std::getline(peek,tmp); // edges
-            int edges = atoi(tmp.c_str());
-            expected_lines = 4 + edges;
+            std::getline(peek,tmp); // edges [requests]
+            std::istringstream counts(tmp);
+            int edges = 0, requests = 0;
+            counts >> edges >> requests;
+            expected_lines = 4 + edges + requests;
         }
         if (expected_lines != -1) {
             int lc2 = 0; for (char c : out) if (c=='\n') ++lc2;
@@ -137,6 +143,11 @@ private:
 struct Job {
     std::shared_ptr<Graph::Graph> graph;
 
+    // options sent for the pipeline algorithms, by name (e.g. "maxflow" -> s=2 t=7)
+    std::map<std::string, AlgorithmParams> params;
+    // requested algorithms outside the pipeline, created through GraphAlgorithmFactory
+    std::vector<std::pair<std::string, AlgorithmParams>> extras;
+
     // per-algorithm results (filled by stages in order)
     std::string mst, maxflow, scc, clique;
 
@@ -148,6 +159,12 @@ struct Job {
 };
 using JobPtr = std::shared_ptr<Job>; // alias for std::shared_ptr<Job>
 
+// Options for one pipeline algorithm (empty if the request did not mention it).
+static AlgorithmParams params_for(const JobPtr& job, const std::string& name) {
+    std::map<std::string, AlgorithmParams>::const_iterator it = job->params.find(name);
+    return it == job->params.end() ? AlgorithmParams() : it->second;
+}
+
 BlockingQueue<JobPtr> Q_mst;
 BlockingQueue<JobPtr> Q_maxflow;
 BlockingQueue<JobPtr> Q_scc;
@@ -170,7 +187,7 @@ static void maxflow_stage() {
     while (!should_exit.load()) {
         JobPtr job = Q_maxflow.pop();
         if (should_exit.load() || !job) break;
-        job->maxflow = alg.run(*job->graph);
+        job->maxflow = alg.run(*job->graph, params_for(job, "maxflow"));
         Q_scc.push(job);
     }
 }
@@ -180,7 +197,7 @@ static void scc_stage() {
     while (!should_exit.load()) {
         JobPtr job = Q_scc.pop();
         if (should_exit.load() || !job) break;
-        job->scc = alg.run(*job->graph);
+        job->scc = alg.run(*job->graph, params_for(job, "scc"));
         Q_clique.push(job);
     }
 }
@@ -190,7 +207,7 @@ static void clique_stage() {
     while (!should_exit.load()) {
         JobPtr job = Q_clique.pop();
         if (should_exit.load() || !job) break;
-        job->clique = alg.run(*job->graph);
+        job->clique = alg.run(*job->graph, params_for(job, "clique"));
 
         // Build final reply and notify the waiting client thread.
         std::ostringstream out;
@@ -230,24 +247,43 @@ static void handle_client(int new_fd) {
     std::getline(iss, line); 
     int num_vertices = atoi(line.c_str());
     std::getline(iss, line); 
-    int num_edges = atoi(line.c_str());
+    std::istringstream counts(line);
+    int num_edges = 0, num_requests = 0;
+    counts >> num_edges >> num_requests;
 
     // Build graph
     auto job = std::make_shared<Job>();
     job->graph = std::make_shared<Graph::Graph>(num_vertices, directed);
 
     // (generating edges) check used edges, if edge is already exists ignore, else create
+    // addEdge also merges the endpoints' components, so they are known once the last edge is read
     std::set<std::pair<int,int>> used;
     for (int i = 0; i < num_edges; ++i) {
         if (!std::getline(iss, line)) break;
         std::istringstream lss(line);
-        int u, v, w; lss >> u >> v >> w;
+        int u, v, w, c; lss >> u >> v >> w;
         if (!lss || u<0 || u>=num_vertices || v<0 || v>=num_vertices || w<=0) continue;
         if (u==v || used.count({u,v})) continue;
-        job->graph->addEdge(u, v, w);
+        if (!(lss >> c)) c = 0; // the cost field is optional
+        job->graph->addEdge(u, v, w, c);
         used.insert({u,v});
     }
 
+    // Algorithm requests: options for a pipeline stage, or an extra algorithm to run.
+    for (int i = 0; i < num_requests; ++i) {
+        if (!std::getline(iss, line)) break;
+        std::istringstream rss(line);
+        std::string name;
+        if (!(rss >> name)) continue;
+        std::string rest;
+        std::getline(rss, rest);
+        AlgorithmParams params = AlgorithmParams::parse(rest);
+        if (name == "mst" || name == "maxflow" || name == "scc" || name == "clique")
+            job->params[name] = params;
+        else
+            job->extras.push_back(std::make_pair(name, params));
+    }
+
     // Print the received graph
     job->graph->printGraph();
 
@@ -262,6 +298,17 @@ static void handle_client(int new_fd) {
         reply = job->reply; // copy out while locked
     }
 
+    // Extra algorithms run on this client's thread, after the pipeline is done with the graph.
+    for (size_t i = 0; i < job->extras.size(); ++i) {
+        const std::string& name = job->extras[i].first;
+        std::unique_ptr<GraphAlgorithm> alg(GraphAlgorithmFactory::create(name));
+        if (!alg) {
+            reply += name + ": Unknown algorithm\n";
+            continue;
+        }
+        reply += name + ": " + alg->run(*job->graph, job->extras[i].second) + "\n";
+    }
+
     // Send and close
     send(new_fd, reply.c_str(), reply.size(), 0);
     close(new_fd);